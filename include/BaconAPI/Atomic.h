@@ -0,0 +1,40 @@
+// Purpose: Wrapper around compiler specific atomic operations
+// Created on: 10/19/26 @ 2:55 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include "Internal/Compiler.h"
+
+#if BA_COMPILER_MSVC
+#   include <intrin.h>
+#   include <Windows.h> // MemoryBarrier
+
+typedef volatile long BA_Atomic_Integer;
+
+#   define BA_ATOMIC_LOAD(atomic) _InterlockedOr((atomic), 0)
+#   define BA_ATOMIC_STORE(atomic, value) ((void) _InterlockedExchange((atomic), (value)))
+#   define BA_ATOMIC_INCREMENT(atomic) _InterlockedIncrement(atomic)
+#   define BA_ATOMIC_DECREMENT(atomic) _InterlockedDecrement(atomic)
+#   define BA_ATOMIC_LOAD_POINTER(atomic) _InterlockedCompareExchangePointer((void* volatile*) (atomic), NULL, NULL)
+#   define BA_ATOMIC_STORE_POINTER(atomic, value) ((void) _InterlockedExchangePointer((void* volatile*) (atomic), (value)))
+#   define BA_ATOMIC_EXCHANGE_POINTER(atomic, value) _InterlockedExchangePointer((void* volatile*) (atomic), (value))
+#   define BA_ATOMIC_COMPARE_EXCHANGE(atomic, expected, value) (_InterlockedCompareExchange((atomic), (value), (expected)) == (expected))
+#   define BA_ATOMIC_COMPARE_EXCHANGE_POINTER(atomic, expected, value) (_InterlockedCompareExchangePointer((void* volatile*) (atomic), (value), (expected)) == (expected))
+#   define BA_ATOMIC_FENCE() MemoryBarrier()
+#else
+typedef long BA_Atomic_Integer;
+
+#   define BA_ATOMIC_LOAD(atomic) __atomic_load_n((atomic), __ATOMIC_ACQUIRE)
+#   define BA_ATOMIC_STORE(atomic, value) __atomic_store_n((atomic), (value), __ATOMIC_RELEASE)
+#   define BA_ATOMIC_INCREMENT(atomic) __atomic_add_fetch((atomic), 1, __ATOMIC_RELAXED)
+#   define BA_ATOMIC_DECREMENT(atomic) __atomic_sub_fetch((atomic), 1, __ATOMIC_ACQ_REL)
+#   define BA_ATOMIC_LOAD_POINTER(atomic) __atomic_load_n((atomic), __ATOMIC_ACQUIRE)
+#   define BA_ATOMIC_STORE_POINTER(atomic, value) __atomic_store_n((atomic), (value), __ATOMIC_RELEASE)
+#   define BA_ATOMIC_EXCHANGE_POINTER(atomic, value) __atomic_exchange_n((atomic), (value), __ATOMIC_ACQ_REL)
+#   define BA_ATOMIC_COMPARE_EXCHANGE(atomic, expected, value) __sync_bool_compare_and_swap((atomic), (expected), (value))
+#   define BA_ATOMIC_COMPARE_EXCHANGE_POINTER(atomic, expected, value) __sync_bool_compare_and_swap((atomic), (expected), (value))
+#   define BA_ATOMIC_FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
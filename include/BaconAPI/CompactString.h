@@ -0,0 +1,92 @@
+// Purpose: Wide strings that only use as many bytes per character as they need
+// Created on: 10/19/26 @ 3:40 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+#include <wchar.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
+#define BA_COMPACTSTRING_NOT_FOUND ((size_t) -1)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Holds the same characters as a wchar_t string, but stores them with one byte each if every character fits in one
+ * byte, two if they fit in two, and only falls back to four bytes otherwise. Mostly ASCII text takes a quarter of the
+ * memory it would as a wchar_t string on platforms where wchar_t is four bytes
+ * @note Since the width is always the smallest one that fits, two strings with different widths can't be equal
+ */
+typedef struct {
+    size_t length;
+    size_t capacity;
+    int width;
+    unsigned char data[];
+} BA_CompactString;
+
+/**
+ * @return NULL if string is NULL, or it failed to allocate memory
+ * @warning Make sure to run BA_CompactString_Free on the returned string
+ */
+BA_CompactString* BA_CompactString_Create(const wchar_t* string);
+BA_CompactString* BA_CompactString_CreateLength(const wchar_t* string, size_t length);
+
+/**
+ * @param string UTF-8
+ * @return NULL if string is NULL, isn't valid UTF-8, or it failed to allocate memory
+ * @note ASCII never goes through wchar_t
+ */
+BA_CompactString* BA_CompactString_CreateFromString(const char* string);
+
+/**
+ * @return 1, 2, or 4
+ */
+int BA_CompactString_GetWidth(const BA_CompactString* string);
+size_t BA_CompactString_GetLength(const BA_CompactString* string);
+
+/**
+ * @warning Undefined behavior if index is out of bounds
+ */
+wchar_t BA_CompactString_GetCharacter(const BA_CompactString* string, size_t index);
+
+BA_Boolean BA_CompactString_Equals(const BA_CompactString* string, const wchar_t* compare);
+BA_Boolean BA_CompactString_EqualsCompact(const BA_CompactString* string, const BA_CompactString* compare);
+BA_Boolean BA_CompactString_StartsWith(const BA_CompactString* string, const wchar_t* compare);
+BA_Boolean BA_CompactString_EndsWith(const BA_CompactString* string, const wchar_t* compare);
+
+/**
+ * @return The index of the first match, BA_COMPACTSTRING_NOT_FOUND if there is none
+ */
+size_t BA_CompactString_Find(const BA_CompactString* string, const wchar_t* compare);
+BA_Boolean BA_CompactString_Contains(const BA_CompactString* string, const wchar_t* compare);
+
+/**
+ * Widens the storage if stringToAppend has characters that don't fit
+ * @param target Might get moved
+ * @return False if it failed to allocate memory, *target is untouched in that case
+ */
+BA_Boolean BA_CompactString_Append(BA_CompactString** target, const wchar_t* stringToAppend);
+
+/**
+ * Materializes a normal wide string, for things that need a wchar_t*
+ * @return NULL if it failed to allocate memory
+ * @warning Make sure to run free on the returned string
+ */
+wchar_t* BA_CompactString_ToWideString(const BA_CompactString* string);
+
+/**
+ * @return UTF-8, NULL if it failed to allocate memory
+ * @warning Make sure to run free on the returned string
+ */
+char* BA_CompactString_ToString(const BA_CompactString* string);
+
+/**
+ * @return How many bytes the string is using, including the header
+ */
+size_t BA_CompactString_GetMemoryUsage(const BA_CompactString* string);
+void BA_CompactString_Free(BA_CompactString* string);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
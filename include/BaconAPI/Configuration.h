@@ -7,15 +7,125 @@
 #pragma once
 
 #include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
 
 #include "BaconAPI/Internal/CPlusPlusSupport.h"
 #include "BaconAPI/Storage/DynamicDictionary.h"
 
+#define BA_CONFIGURATION_PARALLEL_THRESHOLD (16 * 1024 * 1024) // Bytes. Anything bigger gets parsed on every processor
+#define BA_CONFIGURATION_FIELD(structure, member, key, type) {(key), (type), offsetof(structure, member)}
+
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef enum {
+    BA_CONFIGURATION_TYPE_INTEGER, // int64_t
+    BA_CONFIGURATION_TYPE_UNSIGNED, // uint64_t
+    BA_CONFIGURATION_TYPE_DOUBLE, // double
+    BA_CONFIGURATION_TYPE_BOOLEAN, // BA_Boolean. true, yes, on, 1, false, no, off, or 0
+    BA_CONFIGURATION_TYPE_DURATION, // uint64_t milliseconds. A number followed by ms, s, m, h, or d. No unit means milliseconds
+    BA_CONFIGURATION_TYPE_SIZE, // uint64_t bytes. A number followed by B, K, M, G, or T. Units are powers of 1024
+    BA_CONFIGURATION_TYPE_STRING // const char*. Only valid for as long as the configuration is
+} BA_Configuration_Type;
+
+/**
+ * Use BA_CONFIGURATION_FIELD to make these
+ */
+typedef struct {
+    const char* key;
+    BA_Configuration_Type type;
+    size_t offset;
+} BA_Configuration_Field;
+
+/**
+ * @note Starts from the file pointer, and leaves it at the end
+ * @note Files bigger than BA_CONFIGURATION_PARALLEL_THRESHOLD are parsed like BA_Configuration_ParseParallel
+ * @warning Keys, and values, aren't their own allocations. Only free the results with BA_Configuration_Free
+ */
 BA_DynamicDictionary* BA_Configuration_ParseFromFile(FILE* configurationFile);
+
+/**
+ * Each line is "key=value". Everything after the first equals sign is the value, and lines starting with "//" are ignored
+ * @note Data bigger than BA_CONFIGURATION_PARALLEL_THRESHOLD is parsed like BA_Configuration_ParseParallel
+ * @warning Keys, and values, aren't their own allocations. Only free the results with BA_Configuration_Free
+ */
 BA_DynamicDictionary* BA_Configuration_Parse(const char* configurationData);
+
+/**
+ * Splits the data into chunks at line breaks, and parses each chunk on its own thread
+ * @param threadAmount 0 means one for each processor
+ * @note The results are the same as BA_Configuration_Parse, keys stay in the order they were written
+ * @note Small data, or not having threads, parses it on the calling thread
+ * @warning Keys, and values, aren't their own allocations. Only free the results with BA_Configuration_Free
+ */
+BA_DynamicDictionary* BA_Configuration_ParseParallel(const char* configurationData, int threadAmount);
+
+/**
+ * Saves the configuration in a form that can be loaded without parsing it again
+ * @param sourcePath The file it came from, so BA_Configuration_LoadCompiled can tell when it's out of date. Can be NULL
+ * @return False if it failed to write the image, or sourcePath doesn't exist
+ * @note Images only work on the same kind of machine that made them
+ */
+BA_Boolean BA_Configuration_Compile(const BA_DynamicDictionary* parsedConfiguration, const char* imagePath, const char* sourcePath);
+
+/**
+ * Maps an image from BA_Configuration_Compile. Keys, and values, are read straight out of the image
+ * @param sourcePath NULL skips checking if the image is out of date
+ * @return NULL if the image is missing, damaged, from a different version, or the source file changed since it was made
+ * @warning The keys, and values, are read only. Free the results with BA_Configuration_Free
+ */
+BA_DynamicDictionary* BA_Configuration_LoadCompiled(const char* imagePath, const char* sourcePath);
+
+/**
+ * Loads the compiled image if it's still up to date, otherwise parses the source file, and compiles it for next time
+ * @return NULL if it failed to read the source file
+ * @warning Keys, and values, can be read only. Only free the results with BA_Configuration_Free
+ */
+BA_DynamicDictionary* BA_Configuration_ParseFromFileCached(const char* sourcePath, const char* imagePath);
+
+/**
+ * @return The first value with this key, or NULL if there isn't one
+ * @note Configurations from the parse functions look up keys by hash. Adding, removing, or replacing, keys afterward
+ *       makes it go through every key instead. Keys written straight into keys.internalArray aren't noticed, use
+ *       BA_DynamicArray_ReplaceElementAt
+ */
 char* BA_Configuration_GetValue(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless);
 int BA_Configuration_GetIndex(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless);
 
+/**
+ * Converts the value into type, and remembers it so the next call doesn't have to
+ * @param result Has to point to whatever BA_Configuration_Type says the type is. Left alone if this fails
+ * @return False if the key doesn't exist, or the value isn't valid for the type
+ * @note Invalid values are only logged the first time they're seen as each type
+ * @note Only values from the parse functions get cached. Adding, removing, or replacing, keys or values afterward stops
+ *       caching, the same as BA_Configuration_GetValue
+ */
+BA_Boolean BA_Configuration_GetTyped(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, BA_Configuration_Type type, void* result);
+BA_Boolean BA_Configuration_GetInteger(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, int64_t* result);
+BA_Boolean BA_Configuration_GetUnsigned(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, uint64_t* result);
+BA_Boolean BA_Configuration_GetDouble(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, double* result);
+BA_Boolean BA_Configuration_GetBoolean(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, BA_Boolean* result);
+BA_Boolean BA_Configuration_GetDuration(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, uint64_t* milliseconds);
+BA_Boolean BA_Configuration_GetSize(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, uint64_t* bytes);
+
+/**
+ * Fills in a struct from the configuration
+ * @code
+ * typedef struct {
+ *     uint64_t timeout;
+ *     BA_Boolean verbose;
+ * } Settings;
+ *
+ * static const BA_Configuration_Field settingsFields[] = {
+ *     BA_CONFIGURATION_FIELD(Settings, timeout, "network.timeout", BA_CONFIGURATION_TYPE_DURATION),
+ *     BA_CONFIGURATION_FIELD(Settings, verbose, "verbose", BA_CONFIGURATION_TYPE_BOOLEAN)
+ * };
+ * @endcode
+ * @return How many fields were set. Missing, or invalid, fields keep whatever they had before
+ */
+int BA_Configuration_Bind(const BA_DynamicDictionary* parsedConfiguration, const BA_Configuration_Field* fields, int fieldAmount, void* structure, BA_Boolean caseless);
+
+/**
+ * @note Anything you added to the results yourself gets freed too
+ */
 void BA_Configuration_Free(BA_DynamicDictionary* parsedConfiguration);
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,65 @@
+// Purpose: Reloads a configuration file in the background whenever it changes
+// Created on: 10/19/26 @ 8:10 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+#include "Storage/DynamicDictionary.h"
+
+#define BA_CONFIGURATIONWATCHER_MAXIMUM_READERS 128
+#define BA_CONFIGURATIONWATCHER_INTERVAL 100 // Milliseconds
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Keeps the newest parsed version of a file around. Readers never take a lock, old versions get freed once nobody can
+ * be reading them anymore
+ */
+typedef struct BA_ConfigurationWatcher BA_ConfigurationWatcher;
+
+/**
+ * @param oldValue NULL if the key was just added
+ * @param newValue NULL if the key was removed
+ */
+typedef void (*BA_ConfigurationWatcher_ChangeFunction)(const char* key, const char* oldValue, const char* newValue, void* argument);
+
+/**
+ * Parses the file, then starts watching it
+ * @return NULL if it failed to read the file, or allocate memory
+ * @note Linux gets told about changes by inotify, everything else checks the modification time every
+ *       BA_CONFIGURATIONWATCHER_INTERVAL milliseconds
+ * @note If threads aren't available, nothing gets reloaded on its own. Use BA_ConfigurationWatcher_Reload
+ * @warning Make sure to run BA_ConfigurationWatcher_Close on the returned watcher
+ */
+BA_ConfigurationWatcher* BA_ConfigurationWatcher_Open(const char* path);
+
+/**
+ * @warning Every snapshot has to be released before this
+ */
+void BA_ConfigurationWatcher_Close(BA_ConfigurationWatcher* watcher);
+
+/**
+ * Gets the newest version of the configuration, and keeps it alive until it's released
+ * @param reader Gets set to what has to be passed to BA_ConfigurationWatcher_ReleaseSnapshot
+ * @note Doesn't lock. It only waits if more than BA_CONFIGURATIONWATCHER_MAXIMUM_READERS snapshots are held at once
+ * @warning Don't change the returned configuration, other threads could be reading it
+ */
+const BA_DynamicDictionary* BA_ConfigurationWatcher_AcquireSnapshot(BA_ConfigurationWatcher* watcher, int* reader);
+void BA_ConfigurationWatcher_ReleaseSnapshot(BA_ConfigurationWatcher* watcher, int reader);
+
+/**
+ * @param key Only call function when this key changes. NULL means every key
+ * @note Functions are called on the watcher thread, after the new version can already be acquired
+ * @warning Don't add listeners, or reload, from inside of a listener
+ */
+BA_Boolean BA_ConfigurationWatcher_AddListener(BA_ConfigurationWatcher* watcher, const char* key, BA_ConfigurationWatcher_ChangeFunction function, void* argument);
+
+/**
+ * Reads the file again right now, instead of waiting for it to be noticed
+ * @return False if it failed to read the file, the current version is kept
+ */
+BA_Boolean BA_ConfigurationWatcher_Reload(BA_ConfigurationWatcher* watcher);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,69 @@
+// Purpose: Read files of any size in chunks, with the next chunk being read in the background
+// Created on: 10/19/26 @ 7:30 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
+#define BA_FILESTREAM_DEFAULT_CHUNK_SIZE (1024 * 1024)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Double buffered. While you're working on one chunk, a background thread reads the next one. It never gets more than
+ * one chunk ahead, so memory use stays at two chunks no matter how big the file is
+ * @note Small files, and single-threaded programs, read everything on the calling thread instead
+ */
+typedef struct BA_FileStream BA_FileStream;
+
+/**
+ * @return False to stop reading
+ */
+typedef BA_Boolean (*BA_FileStream_ChunkFunction)(const char* chunk, size_t length, void* userData);
+
+/**
+ * @param line Not including the delimiter. Can be changed, but it's only valid until this returns
+ * @return False to stop reading
+ */
+typedef BA_Boolean (*BA_FileStream_LineFunction)(char* line, size_t length, void* userData);
+
+/**
+ * @param chunkSize Zero uses BA_FILESTREAM_DEFAULT_CHUNK_SIZE
+ * @return NULL if it failed to allocate memory
+ * @note Starts reading from wherever the file pointer currently is
+ * @warning Make sure to run BA_FileStream_Close on the returned stream. This doesn't close the file, and you shouldn't
+ *          use the file until the stream is closed
+ */
+BA_FileStream* BA_FileStream_Open(FILE* file, size_t chunkSize);
+void BA_FileStream_Close(BA_FileStream* stream);
+
+/**
+ * Gets the next chunk. Every chunk is chunkSize long, except the last one
+ * @return The length of the chunk, -1 if it's end of file, -2 if reading failed
+ * @note The chunk is only valid until the next call, that's when its buffer gets handed back to the reading thread
+ */
+intmax_t BA_FileStream_Next(BA_FileStream* stream, const char** chunk);
+
+/**
+ * @return If the next chunk is being read on a background thread
+ */
+BA_Boolean BA_FileStream_IsReadingAhead(const BA_FileStream* stream);
+
+/**
+ * @return False if it failed to allocate memory, or reading failed. Stopping early isn't a failure
+ */
+BA_Boolean BA_FileStream_ForEachChunk(FILE* file, size_t chunkSize, BA_FileStream_ChunkFunction function, void* userData);
+
+/**
+ * @param delimiter Defaults to newline if NULL or empty
+ * @return False if it failed to allocate memory, or reading failed. Stopping early isn't a failure
+ */
+BA_Boolean BA_FileStream_ForEachLine(FILE* file, const char* delimiter, BA_FileStream_LineFunction function, void* userData);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,138 @@
+// Purpose: Buffered file writing, for when you have lots of small writes
+// Created on: 10/19/26 @ 7:55 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+#include "Internal/Compiler.h"
+
+#define BA_FILEWRITER_DEFAULT_BUFFER_SIZE (256 * 1024)
+
+#if BA_COMPILER_GCC || BA_COMPILER_CLANG
+#   define BA_FILEWRITER_PRINTF_ATTRIBUTE __attribute__((__format__(__printf__, 2, 3)))
+#else
+#   define BA_FILEWRITER_PRINTF_ATTRIBUTE
+#endif
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Collects writes into one big buffer, and writes it out in as few system calls as possible. Writes that are too big for
+ * the buffer get written together with it, without being copied
+ * @note Not thread safe
+ */
+typedef struct BA_FileWriter BA_FileWriter;
+
+typedef enum {
+    /**
+     * Only flushes when the buffer is full, or when you call BA_FileWriter_Flush
+     */
+    BA_FILEWRITER_FLUSH_POLICY_MANUAL,
+
+    /**
+     * Flushes once this many bytes are buffered
+     */
+    BA_FILEWRITER_FLUSH_POLICY_SIZE,
+
+    /**
+     * Flushes once the buffer has been sitting around for this many milliseconds
+     * @note Only checked when you write something, there's no background thread
+     */
+    BA_FILEWRITER_FLUSH_POLICY_TIME
+} BA_FileWriter_FlushPolicy;
+
+typedef enum {
+    /**
+     * Leave it to the operating system
+     */
+    BA_FILEWRITER_DURABILITY_NONE,
+
+    /**
+     * BA_FileWriter_Flush, BA_FileWriter_Close, and the flush policy, wait until the data is actually on disk
+     * @note A buffer that fills up in the middle of a write goes out without waiting. Data is only durable once one of
+     *       those returns
+     */
+    BA_FILEWRITER_DURABILITY_SYNC,
+
+    /**
+     * Same as sync, but also skips the operating system's cache (O_DIRECT). Good for huge files that won't be read again
+     * soon
+     * @note Only full blocks can skip the cache. A flush that leaves a partial block switches back to normal writes, since
+     *       the file position isn't aligned anymore
+     */
+    BA_FILEWRITER_DURABILITY_DIRECT
+} BA_FileWriter_Durability;
+
+typedef struct {
+    const void* data;
+    size_t length;
+} BA_FileWriter_Segment;
+
+/**
+ * @param append Add to the end of the file, instead of replacing it
+ * @param bufferSize Zero uses BA_FILEWRITER_DEFAULT_BUFFER_SIZE
+ * @return NULL if it failed to open the file, or allocate memory
+ * @warning Make sure to run BA_FileWriter_Close on the returned writer
+ */
+BA_FileWriter* BA_FileWriter_Open(const char* path, BA_Boolean append, size_t bufferSize);
+
+/**
+ * Writes straight to the file's descriptor, skipping stdio's buffer
+ * @param bufferSize Zero uses BA_FILEWRITER_DEFAULT_BUFFER_SIZE
+ * @return NULL if it failed to allocate memory
+ * @note Flushes the file first, so nothing gets out of order
+ * @warning Make sure to run BA_FileWriter_Close on the returned writer. This doesn't close the file
+ */
+BA_FileWriter* BA_FileWriter_OpenFile(FILE* file, size_t bufferSize);
+
+/**
+ * Flushes, and frees the writer
+ * @return False if anything failed to write, ever
+ */
+BA_Boolean BA_FileWriter_Close(BA_FileWriter* writer);
+
+/**
+ * @param value Bytes for size, milliseconds for time, ignored for manual. Zero for size means the buffer size
+ */
+void BA_FileWriter_SetFlushPolicy(BA_FileWriter* writer, BA_FileWriter_FlushPolicy policy, size_t value);
+
+/**
+ * @return False if the operating system or file system doesn't support it. Nothing changes if that happens
+ * @note Flushes first
+ */
+BA_Boolean BA_FileWriter_SetDurability(BA_FileWriter* writer, BA_FileWriter_Durability durability);
+
+/**
+ * @return False if writing failed. Once something fails, everything after will fail too
+ */
+BA_Boolean BA_FileWriter_Write(BA_FileWriter* writer, const void* data, size_t length);
+BA_Boolean BA_FileWriter_WriteString(BA_FileWriter* writer, const char* string);
+BA_Boolean BA_FileWriter_WriteCharacter(BA_FileWriter* writer, char character);
+
+/**
+ * Formats straight into the buffer
+ * @return False if writing, or formatting failed
+ */
+BA_FILEWRITER_PRINTF_ATTRIBUTE BA_Boolean BA_FileWriter_WriteFormat(BA_FileWriter* writer, const char* format, ...);
+
+/**
+ * Writes every segment in order. Small segments get copied, big ones get written with the buffer in one go
+ */
+BA_Boolean BA_FileWriter_WriteVector(BA_FileWriter* writer, const BA_FileWriter_Segment* segments, int amount);
+
+/**
+ * @return False if writing failed
+ */
+BA_Boolean BA_FileWriter_Flush(BA_FileWriter* writer);
+
+/**
+ * @return How much is waiting in the buffer
+ */
+size_t BA_FileWriter_GetBuffered(const BA_FileWriter* writer);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
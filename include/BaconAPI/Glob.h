@@ -0,0 +1,42 @@
+// Purpose: Wildcard matching
+// Created on: 10/19/26 @ 5:30 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Compiled glob pattern. Supports * (anything, including nothing), ? (any one byte), [abc], [a-z], [!abc] or [^abc],
+ * and \ to escape the next character
+ * @note Works on bytes, so ? only matches a single byte of a multi-byte UTF-8 character
+ */
+typedef struct BA_Glob BA_Glob;
+
+/**
+ * @param caseless Only folds ASCII
+ * @return NULL if it failed to allocate memory
+ * @note A [ without a closing ] is treated as a normal character
+ * @warning Make sure to run BA_Glob_Free on the returned glob
+ */
+BA_Glob* BA_Glob_Compile(const char* pattern, BA_Boolean caseless);
+void BA_Glob_Free(BA_Glob* glob);
+
+/**
+ * @note Never backtracks, so this stays fast no matter what the pattern looks like
+ */
+BA_Boolean BA_Glob_Match(const BA_Glob* glob, const char* string);
+BA_Boolean BA_Glob_MatchLength(const BA_Glob* glob, const char* string, size_t length);
+
+/**
+ * Compiles, matches, and frees. Compile the pattern yourself if you're going to use it more than once
+ * @return False if it failed to allocate memory
+ */
+BA_Boolean BA_Glob_MatchOnce(const char* pattern, const char* string, BA_Boolean caseless);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,63 @@
+// Purpose: Fast non-cryptographic hashing
+// Created on: 10/19/26 @ 6:05 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#include "Internal/CPlusPlusSupport.h"
+
+#define BA_HASH_SECRET_SIZE 192
+#define BA_HASH_BUFFER_SIZE 256
+#define BA_HASH_STRIPE_SIZE 64
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * For hashing data that comes in pieces. Gives back the same hash as hashing everything at once
+ * @note Treat everything inside of this as private
+ */
+typedef struct {
+    uint64_t accumulators[8];
+    unsigned char secret[BA_HASH_SECRET_SIZE];
+    unsigned char buffer[BA_HASH_BUFFER_SIZE];
+    unsigned char lastStripe[BA_HASH_STRIPE_SIZE];
+    uint64_t seed;
+    uint64_t totalLength;
+    size_t bufferSize;
+    int stripesInBlock;
+} BA_Hash_State;
+
+/**
+ * @note Hashes are only stable between runs on the same kind of machine. Little, and big endian machines give back
+ *       different hashes
+ * @warning Not cryptographic, don't use these for anything security related
+ */
+uint64_t BA_Hash_Bytes(const void* data, size_t length);
+uint64_t BA_Hash_BytesSeeded(const void* data, size_t length, uint64_t seed);
+uint64_t BA_Hash_String(const char* string);
+uint64_t BA_Hash_WideString(const wchar_t* string);
+uint64_t BA_Hash_Integer(uint64_t integer);
+
+/**
+ * Mixes two hashes together. Order matters
+ */
+uint64_t BA_Hash_Combine(uint64_t hash1, uint64_t hash2);
+
+void BA_Hash_Start(BA_Hash_State* state, uint64_t seed);
+void BA_Hash_Update(BA_Hash_State* state, const void* data, size_t length);
+
+/**
+ * @note Doesn't change the state, so you can keep updating afterward
+ */
+uint64_t BA_Hash_Finish(const BA_Hash_State* state);
+
+/**
+ * @return Which version of the long input loop is being used. "AVX2", "SSE2", "NEON", or "Scalar"
+ */
+const char* BA_Hash_GetImplementation(void);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -79,4 +79,12 @@
 #   undef BA_COMPILER_VERSION_STRING
 #   define BA_COMPILER_VERSION BA_COMPILER_GET_VERSION(__clang_major__, __clang_minor__, __clang_patchlevel__)
 #   define BA_COMPILER_VERSION_STRING __clang_version__
-#endif
\ No newline at end of file
+#endif
+
+#if BA_COMPILER_MSVC
+#   define BA_COMPILER_THREAD_LOCAL __declspec(thread)
+#elif BA_COMPILER_STANDARD_VERSION >= 2011
+#   define BA_COMPILER_THREAD_LOCAL _Thread_local
+#else
+#   define BA_COMPILER_THREAD_LOCAL __thread
+#endif
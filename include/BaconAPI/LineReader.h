@@ -0,0 +1,51 @@
+// Purpose: Fast line by line file reading
+// Created on: 10/19/26 @ 6:40 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "FileStream.h"
+
+#define BA_LINEREADER_DEFAULT_BLOCK_SIZE 65536
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Reads the file in big blocks, and hands out lines straight from its own buffer
+ * @note Reads ahead of the lines it gave back, so don't use the file yourself while reading lines from it
+ */
+typedef struct BA_LineReader BA_LineReader;
+
+/**
+ * @param delimiter Split the file contents by this string, defaults to newline if NULL or empty
+ * @param blockSize How much to read at once, zero uses BA_LINEREADER_DEFAULT_BLOCK_SIZE
+ * @return NULL if it failed to allocate memory
+ * @note Starts reading from wherever the file pointer currently is
+ * @warning Make sure to run BA_LineReader_Free on the returned reader. This doesn't close the file
+ */
+BA_LineReader* BA_LineReader_Create(FILE* file, const char* delimiter, size_t blockSize);
+
+/**
+ * Reads lines out of a stream, so the file gets read in the background while you're working on the lines
+ * @param delimiter Split the file contents by this string, defaults to newline if NULL or empty
+ * @return NULL if it failed to allocate memory
+ * @warning Make sure to run BA_LineReader_Free on the returned reader. This doesn't close the stream
+ */
+BA_LineReader* BA_LineReader_CreateFromStream(BA_FileStream* stream, const char* delimiter);
+void BA_LineReader_Free(BA_LineReader* reader);
+
+/**
+ * Gets the next line in the file
+ * @param line The output string, without the delimiter. Can be NULL
+ * @return The length of the current line, -1 if it's end of file, -2 if it failed to allocate memory, or reading failed
+ * @note The line can be changed, but it's only valid until the next call. Copy it if you want to keep it
+ * @note Lines can be longer than the block size, the buffer grows to fit them
+ */
+intmax_t BA_LineReader_Next(BA_LineReader* reader, char** line);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,58 @@
+// Purpose: Read only view of a whole file, without copying it
+// Created on: 10/19/26 @ 7:05 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Maps regular files into memory. Anything that can't be mapped (pipes, terminals, etc.) gets read into a buffer
+ * instead
+ */
+typedef struct BA_MappedFile BA_MappedFile;
+
+/**
+ * Tells the operating system how you're going to read the file, so it can read ahead, or not
+ */
+typedef enum {
+    BA_MAPPEDFILE_ACCESS_NORMAL,
+    BA_MAPPEDFILE_ACCESS_SEQUENTIAL,
+    BA_MAPPEDFILE_ACCESS_RANDOM
+} BA_MappedFile_Access;
+
+/**
+ * @return NULL if it failed to open the file, or allocate memory
+ * @warning Make sure to run BA_MappedFile_Close on the returned file
+ */
+BA_MappedFile* BA_MappedFile_Open(const char* path, BA_MappedFile_Access access);
+
+/**
+ * @return NULL if it failed to read the file, or allocate memory
+ * @note Regular files are mapped from the start, no matter where the file pointer is. Everything else is read from the
+ *       file pointer to the end
+ * @note You can close the file right after, the mapping stays valid
+ * @warning Make sure to run BA_MappedFile_Close on the returned file
+ */
+BA_MappedFile* BA_MappedFile_OpenFile(FILE* file, BA_MappedFile_Access access);
+void BA_MappedFile_Close(BA_MappedFile* mappedFile);
+
+/**
+ * @note Not null terminated, use BA_MappedFile_GetLength
+ * @warning Read only. Writing to it will crash
+ */
+const char* BA_MappedFile_GetData(const BA_MappedFile* mappedFile);
+size_t BA_MappedFile_GetLength(const BA_MappedFile* mappedFile);
+
+/**
+ * @return False if it had to fall back to reading the file into a buffer
+ */
+BA_Boolean BA_MappedFile_IsMapped(const BA_MappedFile* mappedFile);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
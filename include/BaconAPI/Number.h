@@ -8,12 +8,23 @@
 
 #include <limits.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #include "BaconAPI/Internal/CPlusPlusSupport.h"
 #include "BaconAPI/Internal/Boolean.h"
 
 #define BA_NUMBER_STRING_CONVERT(type, to) type BA_Number_StringTo ## to(const char* string, char** endPointer, BA_Boolean* isError, const char* errorMessage, type defaultValue)
 
+/**
+ * Big enough for any 64-bit integer, including the sign and null terminator
+ */
+#define BA_NUMBER_INTEGER_BUFFER_SIZE 21
+
+/**
+ * Big enough for any double written by BA_Number_DoubleToString, including the null terminator
+ */
+#define BA_NUMBER_DOUBLE_BUFFER_SIZE 32
+
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
 BA_NUMBER_STRING_CONVERT(int8_t, Character);
 BA_NUMBER_STRING_CONVERT(uint8_t, UnsignedCharacter);
@@ -25,6 +36,33 @@ BA_NUMBER_STRING_CONVERT(int64_t, Long);
 BA_NUMBER_STRING_CONVERT(uint64_t, UnsignedLong);
 BA_NUMBER_STRING_CONVERT(intmax_t, LongLong);
 BA_NUMBER_STRING_CONVERT(uintmax_t, UnsignedLongLong);
+
+/**
+ * @return How many decimal digits it takes to write number. Zero has one digit
+ */
+int BA_Number_GetDigitCount(uint64_t number);
+
+/**
+ * Writes number in decimal without going through printf
+ * @param buffer Has to be at least BA_NUMBER_INTEGER_BUFFER_SIZE big
+ * @return The length of the written string, excluding the null terminator
+ */
+size_t BA_Number_UnsignedLongToString(uint64_t number, char* buffer);
+
+/**
+ * @param buffer Has to be at least BA_NUMBER_INTEGER_BUFFER_SIZE big
+ * @return The length of the written string, excluding the null terminator
+ */
+size_t BA_Number_LongToString(int64_t number, char* buffer);
+
+/**
+ * Writes the shortest string that reads back as the exact same double (Ryu)
+ * @param buffer Has to be at least BA_NUMBER_DOUBLE_BUFFER_SIZE big
+ * @return The length of the written string, excluding the null terminator
+ * @note Uses plain decimal notation (always with a decimal point) for exponents from -4 to 15, and scientific
+ *       notation (e.g. 1e+16) otherwise. Infinity and not a number are written as inf, and nan
+ */
+size_t BA_Number_DoubleToString(double number, char* buffer);
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
 
 #define BA_NUMBER_MIN(number, minimum) ((number) > (minimum) ? (number) : (minimum))
@@ -0,0 +1,99 @@
+// Purpose: Text buffer that stays fast to edit no matter how big it gets
+// Created on: 10/19/26 @ 4:15 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+#include "Storage/DynamicArray.h"
+
+#define BA_ROPE_NOT_FOUND ((size_t) -1)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Balanced tree of small text chunks. Inserting, deleting, and looking up positions or lines only touch the chunks
+ * along one path, instead of copying the whole buffer like BA_String_Append, BA_String_Prepend, or BA_String_Replace
+ */
+typedef struct BA_Rope BA_Rope;
+
+/**
+ * @param string Can be NULL for an empty rope
+ * @return NULL if it failed to allocate memory
+ * @warning Make sure to run BA_Rope_Free on the returned rope
+ */
+BA_Rope* BA_Rope_Create(const char* string);
+BA_Rope* BA_Rope_CreateLength(const char* string, size_t length);
+void BA_Rope_Free(BA_Rope* rope);
+
+size_t BA_Rope_GetLength(const BA_Rope* rope);
+
+/**
+ * @return Null terminator if position is out of bounds
+ */
+char BA_Rope_GetCharacter(const BA_Rope* rope, size_t position);
+
+/**
+ * @return False if position is out of bounds, or it failed to allocate memory
+ * @note If it fails to allocate memory in the middle of a big insert, only part of string will be inserted
+ */
+BA_Boolean BA_Rope_Insert(BA_Rope* rope, size_t position, const char* string);
+BA_Boolean BA_Rope_InsertLength(BA_Rope* rope, size_t position, const char* string, size_t length);
+BA_Boolean BA_Rope_Append(BA_Rope* rope, const char* string);
+BA_Boolean BA_Rope_Prepend(BA_Rope* rope, const char* string);
+
+/**
+ * @note Anything past the end is ignored
+ */
+void BA_Rope_Delete(BA_Rope* rope, size_t position, size_t length);
+
+/**
+ * Deletes length bytes at position, and inserts string in their place
+ */
+BA_Boolean BA_Rope_Replace(BA_Rope* rope, size_t position, size_t length, const char* string);
+
+/**
+ * Flattens the rope into a normal string
+ * @return NULL if it failed to allocate memory
+ * @warning Make sure to run free on the returned string
+ */
+char* BA_Rope_ToString(const BA_Rope* rope);
+
+/**
+ * @return NULL if position is out of bounds, or it failed to allocate memory. Anything past the end is ignored
+ * @warning Make sure to run free on the returned string
+ */
+char* BA_Rope_GetSubstring(const BA_Rope* rope, size_t position, size_t length);
+
+/**
+ * @return Always at least one, an empty rope still has an empty line
+ */
+size_t BA_Rope_GetLineAmount(const BA_Rope* rope);
+
+/**
+ * @return Where line starts, BA_ROPE_NOT_FOUND if the line doesn't exist
+ */
+size_t BA_Rope_GetLineStart(const BA_Rope* rope, size_t line);
+
+/**
+ * @return Which line position is on
+ */
+size_t BA_Rope_GetLineFromPosition(const BA_Rope* rope, size_t position);
+
+/**
+ * @return The line without the newline, NULL if the line doesn't exist or it failed to allocate memory
+ * @warning Make sure to run free on the returned string
+ */
+char* BA_Rope_GetLine(const BA_Rope* rope, size_t line);
+
+/**
+ * Same layout as BA_String_Split(string, "\n"), but empty lines are kept so indexes line up with BA_Rope_GetLine
+ * @return NULL if it failed to allocate memory
+ * @warning Make sure to free every element, the internal array, and the dynamic array itself
+ */
+BA_DynamicArray* BA_Rope_SplitLines(const BA_Rope* rope);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
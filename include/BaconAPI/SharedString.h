@@ -0,0 +1,58 @@
+// Purpose: Immutable reference counted strings with copy-on-write
+// Created on: 10/19/26 @ 3:00 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * @return A shared copy of string with a reference count of one. NULL if string is NULL, or it failed to allocate memory
+ * @note The result is a normal null terminated string, so it can be passed to anything that only reads a char*.
+ *       Release it with BA_SharedString_Release, never free
+ */
+const char* BA_SharedString_Create(const char* string);
+
+/**
+ * Same as BA_SharedString_Create, but string doesn't need to be null terminated
+ */
+const char* BA_SharedString_CreateLength(const char* string, size_t length);
+
+/**
+ * Adds a reference. This is how you copy a shared string
+ * @return sharedString
+ * @note Safe to call from multiple threads
+ */
+const char* BA_SharedString_Retain(const char* sharedString);
+
+/**
+ * Removes a reference, freeing the string once nobody references it anymore
+ * @note Does nothing if sharedString is NULL
+ */
+void BA_SharedString_Release(const char* sharedString);
+
+size_t BA_SharedString_GetLength(const char* sharedString);
+long BA_SharedString_GetReferenceCount(const char* sharedString);
+
+/**
+ * Makes sure we're the only one referencing the string, copying it if somebody else is
+ * @param sharedString Gets replaced with the private copy, the reference to the old string is released
+ * @return A writable version of *sharedString. NULL if it failed to allocate memory, *sharedString is untouched in that
+ *         case
+ * @note Don't change the length by writing a null terminator, use BA_SharedString_Append instead
+ */
+char* BA_SharedString_GetMutable(const char** sharedString);
+
+/**
+ * Copy-on-write append. Other references still see the old string
+ * @return False if it failed to allocate memory, *sharedString is untouched in that case
+ */
+BA_Boolean BA_SharedString_Append(const char** sharedString, const char* string);
+BA_Boolean BA_SharedString_AppendLength(const char** sharedString, const char* string, size_t length);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -19,6 +19,7 @@ typedef struct {
     int calledReallocate;
     BA_Boolean frozen;
     size_t originalSize;
+    unsigned int modifications; // Goes up every time an element is added, removed, or replaced. Writing to internalArray yourself doesn't count
 } BA_DynamicArray;
 
 /**
@@ -49,6 +50,11 @@ BA_Boolean BA_DynamicArray_RemoveElementAt(BA_DynamicArray* array, unsigned int
   * @note This doesn't free any memory, you have to do that yourself to prevent memory leaks.
   */
 BA_Boolean BA_DynamicArray_RemoveMatchedElement(BA_DynamicArray* array, const void* element, size_t elementSize, BA_Boolean repeat);
+
+/**
+  * @note This doesn't free the old element, you have to do that yourself to prevent memory leaks.
+  */
+BA_Boolean BA_DynamicArray_ReplaceElementAt(BA_DynamicArray* array, unsigned int index, void* element);
 BA_Boolean BA_DynamicArray_Shrink(BA_DynamicArray* array);
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
 
@@ -16,6 +16,12 @@ typedef struct {
     BA_DynamicArray keys;
     BA_DynamicArray values;
     BA_Boolean frozen;
+
+    /**
+     * Lets BA_Configuration find keys without going through all of them
+     * @note Private, don't touch
+     */
+    const void* lookupIndex;
 } BA_DynamicDictionary;
 
 int BA_DynamicDictionary_GetElementIndexFromKey(const BA_DynamicDictionary* dictionary, const void* key, size_t elementSize);
@@ -63,6 +63,21 @@ char* BA_String_Format(char* target, ...);
  */
 char* BA_String_FormatPremadeList(char* target, va_list arguments);
 
+/**
+ * Formats directly into a caller provided buffer. This never allocates memory
+ * @param capacity Size of buffer, including the null terminator. Passing zero (with a NULL buffer) only calculates the length
+ * @return The length of the fully formatted string (excluding the null terminator), -1 if formatting failed.
+ *         If this is greater or equal to capacity, then the output got truncated
+ * @warning Passing user controlled input as format will open up a uncontrolled format string attack.
+ */
+int BA_String_FormatInto(char* buffer, size_t capacity, const char* format, ...);
+
+/**
+ * @see BA_String_FormatInto
+ * @warning Passing user controlled input as format will open up a uncontrolled format string attack.
+ */
+int BA_String_FormatIntoPremadeList(char* buffer, size_t capacity, const char* format, va_list arguments);
+
 /**
  * @return A char* DynamicArray
  * @note Make sure to free all the elements, including the DynamicArray's internalArray, and the DynamicArray itself, once done using
@@ -79,16 +94,18 @@ BA_DynamicArray* BA_String_SplitCharacter(const char* target, char splitBy);
  * Reads all the file contents into a buffer, this buffer can get quite big
  * @param lengthLimit Limit how long the buffer will be, zero will disable it
  * @param lineLength Tells you how long the resulting buffer is. We do nothing to it if it equals to NULL
- * @return The contents of the file, NULL if it failed to allocate memory
+ * @return The contents of the file, NULL if it failed to allocate memory, or the file can't seek
+ * @note Use BA_MappedFile for big files, it doesn't have to copy the file into memory
  */
 char* BA_String_ReadFile(FILE* file, size_t lengthLimit, size_t* lineLength);
 
 /**
  * Gets the next line in the file
  * @param line The output string
- * @param splitString Split the file contents by this string, defaults to newline if NULL
+ * @param splitString Split the file contents by this string, defaults to newline if NULL or empty
  * @return The length of the current line, -1 if it's end of file, -2 if it failed to allocate buffer
  * @note This moves the file pointer
+ * @note Use BA_LineReader if you're going to read the whole file line by line, it's much faster
  * @warning Make sure to run free on the returned buffer
  */
 intmax_t BA_String_GetLine(FILE* file, char** line, const char* splitString);
@@ -126,6 +143,21 @@ intmax_t BA_String_GetLineCharacter(FILE* file, char** line, char splitCharacter
  */
 char* BA_String_FormatSafe(char* target, int amountOfFormatters, ...);
 char* BA_String_FormatSafePremadeList(char* target, int amountOfFormatters, va_list arguments);
+
+/**
+ * Parses a safe format template once, so it doesn't have to be scanned again on every format
+ * @note Returns NULL if it fails to allocate memory
+ * @warning Make sure to run BA_StringSafeFormat_FreeTemplate on the returned template
+ */
+BA_StringSafeFormat_Template* BA_String_CompileFormatSafe(const char* target);
+
+/**
+ * Same as BA_String_FormatSafe, but with a compiled template. Only allocates the returned string
+ * @note Returns NULL if it fails to allocate memory
+ * @warning Make sure to run free on the returned buffer
+ */
+char* BA_String_FormatSafeCompiled(const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, ...);
+char* BA_String_FormatSafeCompiledPremadeList(const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, va_list arguments);
 char* BA_String_CreateEmpty(void);
 BA_Boolean BA_String_AddCustomSafeFormatter(int identifier, BA_StringSafeFormat_CustomSafeFormatAction actionFunction);
 char* BA_String_Replace(char* target, const char* what, const char* to);
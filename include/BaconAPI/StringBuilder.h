@@ -0,0 +1,89 @@
+// Purpose: Growable string buffer that avoids a copy per append
+// Created on: 10/19/26 @ 9:12 AM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+#include <stdarg.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef struct {
+    /**
+     * Always null terminated
+     */
+    char* buffer;
+    size_t length;
+
+    /**
+     * Includes the null terminator
+     */
+    size_t capacity;
+
+    /**
+     * False if buffer is caller provided storage
+     */
+    BA_Boolean ownsBuffer;
+} BA_StringBuilder;
+
+/**
+ * @param capacity Initial capacity, zero will use the default
+ * @return False if it failed to allocate memory
+ */
+BA_Boolean BA_StringBuilder_Create(BA_StringBuilder* builder, size_t capacity);
+
+/**
+ * Uses caller provided storage (e.g. a stack buffer). It only moves to the heap once the storage is full
+ * @param capacity Size of buffer, including the null terminator. Has to be at least one
+ */
+void BA_StringBuilder_CreateFromBuffer(BA_StringBuilder* builder, char* buffer, size_t capacity);
+
+/**
+ * Makes sure there's enough space to append extraLength more characters without reallocating
+ */
+BA_Boolean BA_StringBuilder_Reserve(BA_StringBuilder* builder, size_t extraLength);
+BA_Boolean BA_StringBuilder_Append(BA_StringBuilder* builder, const char* string);
+BA_Boolean BA_StringBuilder_AppendLength(BA_StringBuilder* builder, const char* string, size_t length);
+BA_Boolean BA_StringBuilder_AppendCharacter(BA_StringBuilder* builder, char character);
+
+/**
+ * Formats straight into the free space of the builder. Only formats a second time if the output got truncated
+ * @warning Passing user controlled input as format will open up a uncontrolled format string attack.
+ */
+BA_Boolean BA_StringBuilder_AppendFormat(BA_StringBuilder* builder, const char* format, ...);
+
+/**
+ * @warning Passing user controlled input as format will open up a uncontrolled format string attack.
+ */
+BA_Boolean BA_StringBuilder_AppendFormatPremadeList(BA_StringBuilder* builder, const char* format, va_list arguments);
+
+/**
+ * Resets the length without giving back any memory
+ */
+void BA_StringBuilder_Clear(BA_StringBuilder* builder);
+
+/**
+ * @return A heap string with the builders contents, NULL if it failed to allocate memory
+ * @note The builder is destroyed afterward, you will need to create it again to reuse it
+ * @warning Make sure to run free on the returned buffer
+ */
+char* BA_StringBuilder_Finish(BA_StringBuilder* builder);
+void BA_StringBuilder_Free(BA_StringBuilder* builder);
+
+/**
+ * Gets a cleared builder that only belongs to the current thread. Starts out using static storage, so short strings
+ * never allocate
+ * @warning Don't hold onto this after calling something else that might use it
+ */
+BA_StringBuilder* BA_StringBuilder_GetThreadLocal(void);
+
+/**
+ * Gives back any heap memory the current threads builder grew into
+ */
+void BA_StringBuilder_FreeThreadLocal(void);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,87 @@
+// Purpose: Keeps one canonical copy of each distinct string
+// Created on: 10/19/26 @ 1:05 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+#include "Storage/DynamicArray.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Small integer that stands for an interned string. Atoms are handed out in order, starting from zero
+ */
+typedef int BA_StringIntern_Atom;
+
+#define BA_STRINGINTERN_INVALID_ATOM (-1)
+
+/**
+ * @return The canonical copy of string. Interning an equal string will always give back the same pointer, so you can
+ *         compare them with ==. NULL if string is NULL, or it failed to allocate memory
+ * @note The returned string lives until BA_StringIntern_Free is called. Don't free, or modify it
+ */
+const char* BA_StringIntern_Intern(const char* string);
+
+/**
+ * Same as BA_StringIntern_Intern, but string doesn't need to be null terminated
+ */
+const char* BA_StringIntern_InternLength(const char* string, size_t length);
+
+/**
+ * Looks up string without adding it
+ * @return The canonical copy, or NULL if string was never interned
+ */
+const char* BA_StringIntern_Find(const char* string);
+
+/**
+ * Interns every string inside of array while only taking the lock once
+ * @param output Has to be big enough to hold array->used pointers. Can be the arrays own internalArray
+ * @return False if it failed to allocate memory, output is only partially filled in that case
+ * @warning Undefined behavior if the array contains anything other than strings
+ */
+BA_Boolean BA_StringIntern_InternDynamicArray(const BA_DynamicArray* array, const char** output);
+
+/**
+ * @return The atom for string, interning it if needed. BA_STRINGINTERN_INVALID_ATOM if it failed to allocate memory
+ */
+BA_StringIntern_Atom BA_StringIntern_GetAtom(const char* string);
+
+/**
+ * @return NULL if the atom doesn't exist
+ */
+const char* BA_StringIntern_GetString(BA_StringIntern_Atom atom);
+
+/**
+ * @warning Undefined behavior if interned didn't come from this module
+ */
+BA_StringIntern_Atom BA_StringIntern_GetAtomFromInterned(const char* interned);
+
+/**
+ * @return The hash that was calculated when the string got interned
+ * @warning Undefined behavior if interned didn't come from this module
+ */
+uint64_t BA_StringIntern_GetHash(const char* interned);
+
+/**
+ * @warning Undefined behavior if interned didn't come from this module
+ */
+size_t BA_StringIntern_GetLength(const char* interned);
+int BA_StringIntern_GetAmount(void);
+
+/**
+ * Frees every interned string
+ * @warning Every pointer, and atom you've gotten before this is invalid afterward
+ */
+void BA_StringIntern_Free(void);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
+
+/**
+ * Only works on strings that came from BA_StringIntern
+ */
+#define BA_STRINGINTERN_EQUALS(interned1, interned2) ((interned1) == (interned2))
@@ -10,10 +10,32 @@
 #include "Internal/Boolean.h"
 
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * @return NULL if index was deallocated. That stays true after something else reuses its slot
+ * @note A slot has to be reused 128 times before an old index for it could work again
+ */
 void* BA_StringManager_Get(int index);
 BA_Boolean BA_StringManager_IsWideString(int index);
 
+/**
+ * @return The index, or -1 if it failed to allocate memory
+ * @note Deallocated slots get reused, so indexes aren't always in order
+ */
 int BA_StringManager_Allocate(const void* originalString, BA_Boolean isWideString);
+
+/**
+ * Takes a reference to sharedString instead of copying it. The reference gets released on deallocation
+ * @param sharedString Has to come from BA_SharedString
+ */
+int BA_StringManager_AllocateShared(const char* sharedString);
+
+/**
+ * @param index -1 deallocates every string. Indexes that were already deallocated are ignored
+ */
 void BA_StringManager_Deallocate(int index);
+
+/**
+ * @note Does nothing if index was deallocated
+ */
 void BA_StringManager_Replace(int index, const void* newString, BA_Boolean isWideString);
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
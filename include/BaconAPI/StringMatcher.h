@@ -0,0 +1,66 @@
+// Purpose: Searches for a lot of strings at once
+// Created on: 10/19/26 @ 4:50 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+#include "Storage/DynamicArray.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Aho-Corasick automaton. Scanning goes over the text once, no matter how many patterns there are
+ */
+typedef struct BA_StringMatcher BA_StringMatcher;
+
+typedef struct {
+    size_t position;
+    int pattern; // Index into the array the matcher was created with
+} BA_StringMatcher_Match;
+
+/**
+ * @return False to stop scanning
+ */
+typedef BA_Boolean (*BA_StringMatcher_Callback)(const BA_StringMatcher_Match* match, void* userData);
+
+/**
+ * @param patterns Strings to look for. NULL, and empty strings are skipped, but still keep their index
+ * @param caseless Only folds ASCII
+ * @return NULL if it failed to allocate memory
+ * @note Small pattern sets get compiled into a full transition table, bigger ones into a compressed automaton that
+ *       uses a lot less memory
+ * @warning Make sure to run BA_StringMatcher_Free on the returned matcher
+ */
+BA_StringMatcher* BA_StringMatcher_Create(const BA_DynamicArray* patterns, BA_Boolean caseless);
+void BA_StringMatcher_Free(BA_StringMatcher* matcher);
+
+/**
+ * Reports every match, including overlapping ones, in the order they end
+ * @param callback Can be NULL to only count
+ * @return The amount of matches reported
+ */
+size_t BA_StringMatcher_Scan(const BA_StringMatcher* matcher, const char* text, BA_StringMatcher_Callback callback, void* userData);
+size_t BA_StringMatcher_ScanLength(const BA_StringMatcher* matcher, const char* text, size_t length, BA_StringMatcher_Callback callback, void* userData);
+
+/**
+ * @return True as soon as any pattern is found
+ */
+BA_Boolean BA_StringMatcher_Contains(const BA_StringMatcher* matcher, const char* text);
+
+/**
+ * @param match Can be NULL
+ * @return False if nothing matched
+ * @note First means the match that ends first
+ */
+BA_Boolean BA_StringMatcher_FindFirst(const BA_StringMatcher* matcher, const char* text, BA_StringMatcher_Match* match);
+
+/**
+ * @return True if the matcher uses a full transition table
+ */
+BA_Boolean BA_StringMatcher_IsDense(const BA_StringMatcher* matcher);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -6,6 +6,11 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
 typedef enum {
     BA_STRINGSAFEFORMAT_TYPE_STRING = 1000,
@@ -42,6 +47,28 @@ typedef enum {
 typedef void* (*BA_StringSafeFormat_CustomSafeFormatAction)(void* buffer, BA_Boolean fromWideCharacter, void** argument);
 
 BA_Boolean BA_StringSafeFormat_AddCustomSafeFormatter(int identifier, BA_StringSafeFormat_CustomSafeFormatAction actionFunction);
+
+/**
+ * A safe format template that has already been parsed. Never modified after it's compiled, so it's safe to share
+ * between threads
+ * @note Create using BA_String_CompileFormatSafe, or BA_WideString_CompileFormatSafe
+ */
+typedef struct {
+    /**
+     * Either char*, or wchar_t*, depending on isWideString
+     */
+    void* templateString;
+    size_t templateLength;
+    BA_Boolean isWideString;
+
+    /**
+     * Position of the '%' for every %s, in order
+     */
+    size_t* slotPositions;
+    int slotAmount;
+} BA_StringSafeFormat_Template;
+
+void BA_StringSafeFormat_FreeTemplate(BA_StringSafeFormat_Template* compiledTemplate);
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
 
 #define BA_STRINGSAFEFORMAT_ARGUMENT_STRING(value) BA_STRINGSAFEFORMAT_TYPE_STRING, value
@@ -49,6 +76,7 @@ BA_CPLUSPLUS_SUPPORT_GUARD_END()
 
 /**
  * Requires a decimal point, even if the number after is just zero
+ * @note Written as the shortest string that reads back as the same double (see BA_Number_DoubleToString)
  */
 #define BA_STRINGSAFEFORMAT_ARGUMENT_DOUBLE(value) BA_STRINGSAFEFORMAT_TYPE_DOUBLE, value
 #define BA_STRINGSAFEFORMAT_ARGUMENT_CHARACTER(value) BA_STRINGSAFEFORMAT_TYPE_CHARACTER, value
@@ -16,14 +16,33 @@ BA_CPLUSPLUS_SUPPORT_GUARD_START()
 
 typedef pthread_t BA_Thread;
 typedef pthread_mutex_t BA_Thread_Lock;
+typedef pthread_once_t BA_Thread_Once;
+
+#   if BA_OPERATINGSYSTEM_APPLE
+// Apple doesn't support unnamed POSIX semaphores
+#       include <dispatch/dispatch.h>
+
+typedef dispatch_semaphore_t BA_Thread_Semaphore;
+#   else
+#       include <semaphore.h>
+
+typedef sem_t BA_Thread_Semaphore;
+#   endif
+
+#   define BA_THREAD_ONCE_INITIALIZER PTHREAD_ONCE_INIT
 #elif BA_OPERATINGSYSTEM_WINDOWS
 #   include <Windows.h>
 
 typedef HANDLE BA_Thread;
 typedef HANDLE BA_Thread_Lock;
+typedef INIT_ONCE BA_Thread_Once;
+typedef HANDLE BA_Thread_Semaphore;
+
+#   define BA_THREAD_ONCE_INITIALIZER INIT_ONCE_STATIC_INIT
 #endif
 
 typedef void (*BA_Thread_Function)(void*);
+typedef void (*BA_Thread_OnceFunction)(void);
 
 BA_Thread BA_Thread_GetCurrent(void);
 BA_Boolean BA_Thread_IsSingleThreaded(void);
@@ -34,6 +53,11 @@ BA_Boolean BA_Thread_IsSingleThreaded(void);
 int BA_Thread_GetLimit(void);
 int BA_Thread_GetAmount(void);
 
+/**
+ * @return How many processors can run threads right now. At least one
+ */
+int BA_Thread_GetProcessorAmount(void);
+
 BA_Boolean BA_Thread_Create(BA_Thread* thread, BA_Thread_Function threadFunction, const char* name, void* argument);
 BA_Boolean BA_Thread_Join(BA_Thread thread, void* returnValue);
 BA_Boolean BA_Thread_CreateLock(BA_Thread_Lock* lock);
@@ -41,6 +65,25 @@ BA_Boolean BA_Thread_UseLock(BA_Thread_Lock* lock);
 BA_Boolean BA_Thread_Unlock(BA_Thread_Lock* lock);
 BA_Boolean BA_Thread_DestroyLock(BA_Thread_Lock* lock);
 
+/**
+ * @param value How many times it can be waited on before it blocks
+ */
+BA_Boolean BA_Thread_CreateSemaphore(BA_Thread_Semaphore* semaphore, unsigned int value);
+
+/**
+ * Blocks until the semaphore is above zero, then decrements it
+ */
+BA_Boolean BA_Thread_WaitSemaphore(BA_Thread_Semaphore* semaphore);
+BA_Boolean BA_Thread_PostSemaphore(BA_Thread_Semaphore* semaphore);
+BA_Boolean BA_Thread_DestroySemaphore(BA_Thread_Semaphore* semaphore);
+
+/**
+ * Runs function exactly once, no matter how many threads call this at the same time. Every caller waits until it has
+ * finished
+ * @param once Has to be initialized with BA_THREAD_ONCE_INITIALIZER
+ */
+BA_Boolean BA_Thread_CallOnce(BA_Thread_Once* once, BA_Thread_OnceFunction function);
+
 /**
  * @param limit -1 means unlimited
  */
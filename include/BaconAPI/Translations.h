@@ -6,25 +6,117 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <stddef.h>
+
 #include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
 #include "StringManager.h"
 
+#define BA_TRANSLATIONS_HASH_OFFSET 0xCBF29CE484222325
+#define BA_TRANSLATIONS_HASH_PRIME 0x100000001B3
+#define BA_TRANSLATIONS_HASH_MAXIMUM_LENGTH 64 // Longer keys get hashed when the program runs
+
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * A compiled language, mapped straight from the file. Every process using the same pack shares its memory
+ */
+typedef struct BA_Translations_Pack BA_Translations_Pack;
+
+/**
+ * @return The code of the pack being used, otherwise the last loaded language
+ */
 const char* BA_Translations_GetLanguageCode(const char* code);
 
 /**
- * @note This function can be slow. Cache the returned ID
+ * The hash translation keys are looked up by. Same as BA_TRANSLATIONS_HASH
+ */
+uint64_t BA_Translations_HashKey(const char* key, size_t length);
+
+/**
+ * @return The ID to pass to BA_StringManager_Get, or -1 if no language has this key. IDs stay the same between
+ *         languages
+ * @note Has to hash the key every time. Use BA_TRANSLATIONS_HASH, or cache the returned ID
  */
 int BA_Translations_GetTranslationId(const char* key);
 
+/**
+ * Same as BA_Translations_GetTranslationId, without having to hash the key
+ * @param hash From BA_TRANSLATIONS_HASH, or BA_Translations_HashKey
+ */
+int BA_Translations_GetTranslationIdFromHash(uint64_t hash);
+
+/**
+ * @note Loading a key with the same hash as a different key logs an error, and skips it
+ */
 void BA_Translations_LoadLanguage(const char* code, const char* buffer);
+
+/**
+ * @return The translation from the pack being used, otherwise from the loaded languages. NULL if there isn't one
+ * @note Doesn't lock, or allocate
+ */
+const char* BA_Translations_Get(const char* key);
+
+/**
+ * Same as BA_Translations_Get, without having to hash the key
+ * @param hash From BA_TRANSLATIONS_HASH, or BA_Translations_HashKey
+ */
+const char* BA_Translations_GetFromHash(uint64_t hash);
+
+/**
+ * Turns a language into a pack, that can be used without parsing it again
+ * @param code Has to be shorter than 16 characters
+ * @return False if it failed to write the pack
+ * @note Packs only work on the same kind of machine that made them
+ */
+BA_Boolean BA_Translations_CompilePack(const char* code, const char* buffer, const char* packPath);
+
+/**
+ * @return NULL if the pack is missing, damaged, or from a different version
+ * @warning Make sure to run BA_Translations_ClosePack on the returned pack
+ */
+BA_Translations_Pack* BA_Translations_OpenPack(const char* packPath);
+
+/**
+ * Stops using the pack if it's being used
+ * @warning Nothing can be reading translations from it anymore
+ */
+void BA_Translations_ClosePack(BA_Translations_Pack* pack);
+
+/**
+ * Switches every translation over to the pack at once. Nothing gets copied
+ * @param pack NULL goes back to the loaded languages
+ * @note Translation IDs, and BA_StringManager, only know about loaded languages
+ */
+void BA_Translations_UsePack(BA_Translations_Pack* pack);
 void BA_Translations_Destroy(void);
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
 
+// Characters past the end of the key leave the hash alone
+#define BA_TRANSLATIONS_HASH_STEP(hash, key, i) \
+((((uint64_t) (hash)) ^ ((uint64_t) (unsigned char) (key)[(i) < sizeof(key) - 1 ? (i) : 0] * ((i) < sizeof(key) - 1))) * ((i) < sizeof(key) - 1 ? BA_TRANSLATIONS_HASH_PRIME : 1))
+
+#define BA_TRANSLATIONS_HASH_STEP4(hash, key, i) \
+BA_TRANSLATIONS_HASH_STEP(BA_TRANSLATIONS_HASH_STEP(BA_TRANSLATIONS_HASH_STEP(BA_TRANSLATIONS_HASH_STEP(hash, key, i), key, (i) + 1), key, (i) + 2), key, (i) + 3)
+
+#define BA_TRANSLATIONS_HASH_STEP16(hash, key, i) \
+BA_TRANSLATIONS_HASH_STEP4(BA_TRANSLATIONS_HASH_STEP4(BA_TRANSLATIONS_HASH_STEP4(BA_TRANSLATIONS_HASH_STEP4(hash, key, i), key, (i) + 4), key, (i) + 8), key, (i) + 12)
+
+/**
+ * Hashes a key while compiling, when optimizations are on
+ * @param key Has to be a string literal
+ */
+#define BA_TRANSLATIONS_HASH(key) \
+(sizeof("" key) - 1 > BA_TRANSLATIONS_HASH_MAXIMUM_LENGTH ? BA_Translations_HashKey("" key, sizeof("" key) - 1) : \
+ BA_TRANSLATIONS_HASH_STEP16(BA_TRANSLATIONS_HASH_STEP16(BA_TRANSLATIONS_HASH_STEP16(BA_TRANSLATIONS_HASH_STEP16(BA_TRANSLATIONS_HASH_OFFSET, "" key, 0), "" key, 16), "" key, 32), "" key, 48))
+
+/**
+ * Makes a function that gets the current translation of key
+ * @param key Has to be a string literal
+ * @note Nothing is cached, so it always follows the current pack, or language. It can be called from any thread while a
+ *       language isn't being loaded
+ */
 #define BA_TRANSLATIONS_PRELOAD(functionName, key) \
 const char* functionName(void) {                   \
-    static int translationId = -1;                 \
-    if (translationId == -1)                       \
-        translationId = BA_Translations_GetTranslationId(key); \
-    return BA_StringManager_Get(translationId);    \
+    return BA_Translations_GetFromHash(BA_TRANSLATIONS_HASH(key)); \
 }
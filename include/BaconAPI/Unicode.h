@@ -0,0 +1,65 @@
+// Purpose: UTF-8, UTF-16, and UTF-32 conversion
+// Created on: 10/19/26 @ 2:20 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Internal/CPlusPlusSupport.h"
+#include "Internal/Boolean.h"
+
+/**
+ * Returned when the input is not valid
+ */
+#define BA_UNICODE_ERROR ((size_t) -1)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+BA_Boolean BA_Unicode_IsASCII(const char* string, size_t length);
+
+/**
+ * Rejects overlong sequences, surrogates, code points above U+10FFFF, and cut off sequences
+ */
+BA_Boolean BA_Unicode_ValidateUTF8(const char* string, size_t length);
+
+/**
+ * @param output Has to be able to hold length code points
+ * @return The amount of code points written, BA_UNICODE_ERROR if input is not valid UTF-8
+ * @note Does not null terminate
+ */
+size_t BA_Unicode_UTF8ToUTF32(const char* input, size_t length, uint32_t* output);
+
+/**
+ * @param output Has to be able to hold length code units
+ * @return The amount of code units written, BA_UNICODE_ERROR if input is not valid UTF-8
+ * @note Does not null terminate
+ */
+size_t BA_Unicode_UTF8ToUTF16(const char* input, size_t length, uint16_t* output);
+
+/**
+ * @param output Has to be big enough, see BA_Unicode_GetUTF8LengthFromUTF32
+ * @return The amount of bytes written, BA_UNICODE_ERROR if input contains surrogates or code points above U+10FFFF
+ * @note Does not null terminate
+ */
+size_t BA_Unicode_UTF32ToUTF8(const uint32_t* input, size_t length, char* output);
+
+/**
+ * @param output Has to be big enough, see BA_Unicode_GetUTF8LengthFromUTF16
+ * @return The amount of bytes written, BA_UNICODE_ERROR if input contains unpaired surrogates
+ * @note Does not null terminate
+ */
+size_t BA_Unicode_UTF16ToUTF8(const uint16_t* input, size_t length, char* output);
+
+/**
+ * @return The exact amount of bytes the UTF-8 version needs, BA_UNICODE_ERROR if input is not valid
+ */
+size_t BA_Unicode_GetUTF8LengthFromUTF32(const uint32_t* input, size_t length);
+
+/**
+ * @return The exact amount of bytes the UTF-8 version needs, BA_UNICODE_ERROR if input is not valid
+ */
+size_t BA_Unicode_GetUTF8LengthFromUTF16(const uint16_t* input, size_t length);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -7,10 +7,12 @@
 #pragma once
 
 #include <wchar.h>
+#include <stdarg.h>
 
 #include "Internal/CPlusPlusSupport.h"
 #include "Internal/Boolean.h"
 #include "Storage/DynamicArray.h"
+#include "StringSafeFormat.h"
 
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
 BA_Boolean BA_WideString_Contains(const wchar_t* string, const wchar_t* compare, BA_Boolean caseless);
@@ -31,10 +33,32 @@ wchar_t* BA_WideString_AppendCharacter(wchar_t* target, wchar_t character);
 wchar_t* BA_WideString_PrependCharacter(wchar_t* target, wchar_t character);
 wchar_t* BA_WideString_Format(wchar_t* target, ...);
 wchar_t* BA_WideString_FormatPremadeList(wchar_t* target, va_list arguments);
+
+/**
+ * Formats directly into a caller provided buffer. This never allocates memory
+ * @param capacity Size of buffer, including the null terminator
+ * @return The length of the formatted string (excluding the null terminator), -1 if formatting failed or the output got truncated
+ * @note Unlike BA_String_FormatInto, there is no way to know how big the buffer has to be
+ */
+int BA_WideString_FormatInto(wchar_t* buffer, size_t capacity, const wchar_t* format, ...);
+int BA_WideString_FormatIntoPremadeList(wchar_t* buffer, size_t capacity, const wchar_t* format, va_list arguments);
 BA_DynamicArray* BA_WideString_Split(const wchar_t* target, const wchar_t* splitBy);
 BA_DynamicArray* BA_WideString_SplitCharacter(const wchar_t* target, wchar_t splitBy);
 wchar_t* BA_WideString_FormatSafe(wchar_t* target, int amountOfFormatters, ...);
 wchar_t* BA_WideString_FormatSafePremadeList(wchar_t* target, int amountOfFormatters, va_list arguments);
+
+/**
+ * @note Returns NULL if it fails to allocate memory
+ * @warning Make sure to run BA_StringSafeFormat_FreeTemplate on the returned template
+ */
+BA_StringSafeFormat_Template* BA_WideString_CompileFormatSafe(const wchar_t* target);
+
+/**
+ * @note Returns NULL if it fails to allocate memory
+ * @warning Make sure to run free on the returned buffer
+ */
+wchar_t* BA_WideString_FormatSafeCompiled(const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, ...);
+wchar_t* BA_WideString_FormatSafeCompiledPremadeList(const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, va_list arguments);
 wchar_t* BA_WideString_CreateEmpty(void);
 wchar_t* BA_WideString_Replace(wchar_t* target, const wchar_t* what, const wchar_t* to);
 wchar_t* BA_WideString_ReplaceCharacter(wchar_t* target, wchar_t what, wchar_t to);
@@ -0,0 +1,341 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "BaconAPI/CompactString.h"
+#include "BaconAPI/Unicode.h"
+
+#define BA_COMPACTSTRING_DATA(string, type) ((type*) (string)->data)
+
+// Runs body with type set to the storage type of width
+#define BA_COMPACTSTRING_FOR_WIDTH(width, body) \
+do {                                            \
+    switch (width) {                            \
+        case 1: {                               \
+            typedef uint8_t type;               \
+            body                                \
+            break;                              \
+        }                                       \
+                                                \
+        case 2: {                               \
+            typedef uint16_t type;              \
+            body                                \
+            break;                              \
+        }                                       \
+                                                \
+        default: {                              \
+            typedef uint32_t type;              \
+            body                                \
+            break;                              \
+        }                                       \
+    }                                           \
+} while (BA_BOOLEAN_FALSE)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+static int BA_CompactString_GetNeededWidth(const wchar_t* string, size_t length) {
+    int width = 1;
+
+    for (size_t i = 0; i < length; i++) {
+        uint32_t character = (uint32_t) string[i];
+
+        if (character > 0xFFFF)
+            return 4;
+
+        if (character > 0xFF)
+            width = 2;
+    }
+
+    return width;
+}
+
+static BA_CompactString* BA_CompactString_Allocate(size_t capacity, int width) {
+    BA_CompactString* string = malloc(sizeof(BA_CompactString) + capacity * width);
+
+    if (string == NULL)
+        return NULL;
+
+    string->length = 0;
+    string->capacity = capacity;
+    string->width = width;
+    return string;
+}
+
+/**
+ * @note Every character has to fit in the width of target
+ */
+static void BA_CompactString_Store(BA_CompactString* target, size_t offset, const wchar_t* string, size_t length) {
+    if ((size_t) target->width == sizeof(wchar_t)) {
+        memcpy(target->data + offset * target->width, string, length * sizeof(wchar_t));
+        return;
+    }
+
+    BA_COMPACTSTRING_FOR_WIDTH(target->width, {
+        type* data = BA_COMPACTSTRING_DATA(target, type) + offset;
+
+        for (size_t i = 0; i < length; i++)
+            data[i] = (type) string[i];
+    });
+}
+
+static BA_Boolean BA_CompactString_RegionEquals(const BA_CompactString* string, size_t offset, const wchar_t* compare, size_t length) {
+    BA_COMPACTSTRING_FOR_WIDTH(string->width, {
+        const type* data = BA_COMPACTSTRING_DATA(string, const type) + offset;
+
+        for (size_t i = 0; i < length; i++) {
+            if ((uint32_t) data[i] != (uint32_t) compare[i])
+                return BA_BOOLEAN_FALSE;
+        }
+    });
+
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_CompactString* BA_CompactString_Create(const wchar_t* string) {
+    if (string == NULL)
+        return NULL;
+
+    return BA_CompactString_CreateLength(string, wcslen(string));
+}
+
+BA_CompactString* BA_CompactString_CreateLength(const wchar_t* string, size_t length) {
+    if (string == NULL)
+        return NULL;
+
+    BA_CompactString* compactString = BA_CompactString_Allocate(length, BA_CompactString_GetNeededWidth(string, length));
+
+    if (compactString == NULL)
+        return NULL;
+
+    BA_CompactString_Store(compactString, 0, string, length);
+
+    compactString->length = length;
+    return compactString;
+}
+
+BA_CompactString* BA_CompactString_CreateFromString(const char* string) {
+    if (string == NULL)
+        return NULL;
+
+    size_t length = strlen(string);
+
+    if (BA_Unicode_IsASCII(string, length)) {
+        BA_CompactString* compactString = BA_CompactString_Allocate(length, 1);
+
+        if (compactString == NULL)
+            return NULL;
+
+        memcpy(compactString->data, string, length);
+
+        compactString->length = length;
+        return compactString;
+    }
+
+    // Never needs more code units than there are bytes
+    wchar_t* wideString = malloc(length * sizeof(wchar_t));
+
+    if (wideString == NULL)
+        return NULL;
+
+#if WCHAR_MAX > 0xFFFF
+    size_t wideLength = BA_Unicode_UTF8ToUTF32(string, length, (uint32_t*) wideString);
+#else
+    size_t wideLength = BA_Unicode_UTF8ToUTF16(string, length, (uint16_t*) wideString);
+#endif
+
+    BA_CompactString* compactString = wideLength != BA_UNICODE_ERROR ? BA_CompactString_CreateLength(wideString, wideLength) : NULL;
+
+    free(wideString);
+    return compactString;
+}
+
+int BA_CompactString_GetWidth(const BA_CompactString* string) {
+    return string->width;
+}
+
+size_t BA_CompactString_GetLength(const BA_CompactString* string) {
+    return string->length;
+}
+
+wchar_t BA_CompactString_GetCharacter(const BA_CompactString* string, size_t index) {
+    BA_COMPACTSTRING_FOR_WIDTH(string->width, {
+        return (wchar_t) BA_COMPACTSTRING_DATA(string, const type)[index];
+    });
+
+    return 0;
+}
+
+BA_Boolean BA_CompactString_Equals(const BA_CompactString* string, const wchar_t* compare) {
+    return string->length == wcslen(compare) && BA_CompactString_RegionEquals(string, 0, compare, string->length);
+}
+
+BA_Boolean BA_CompactString_EqualsCompact(const BA_CompactString* string, const BA_CompactString* compare) {
+    return string->length == compare->length && string->width == compare->width &&
+           memcmp(string->data, compare->data, string->length * string->width) == 0;
+}
+
+BA_Boolean BA_CompactString_StartsWith(const BA_CompactString* string, const wchar_t* compare) {
+    size_t length = wcslen(compare);
+
+    return length <= string->length && BA_CompactString_RegionEquals(string, 0, compare, length);
+}
+
+BA_Boolean BA_CompactString_EndsWith(const BA_CompactString* string, const wchar_t* compare) {
+    size_t length = wcslen(compare);
+
+    return length <= string->length && BA_CompactString_RegionEquals(string, string->length - length, compare, length);
+}
+
+size_t BA_CompactString_Find(const BA_CompactString* string, const wchar_t* compare) {
+    size_t length = wcslen(compare);
+
+    if (length == 0)
+        return 0;
+
+    // Anything wider than our storage can't be in here
+    if (length > string->length || BA_CompactString_GetNeededWidth(compare, length) > string->width)
+        return BA_COMPACTSTRING_NOT_FOUND;
+
+    size_t last = string->length - length;
+
+    if (string->width == 1) {
+        const unsigned char* data = string->data;
+        const unsigned char* end = data + last + 1;
+        unsigned char first = (unsigned char) compare[0];
+
+        while ((data = memchr(data, first, end - data)) != NULL) {
+            size_t index = data - string->data;
+
+            if (BA_CompactString_RegionEquals(string, index, compare, length))
+                return index;
+
+            data++;
+        }
+
+        return BA_COMPACTSTRING_NOT_FOUND;
+    }
+
+    for (size_t i = 0; i <= last; i++) {
+        if (BA_CompactString_GetCharacter(string, i) == compare[0] && BA_CompactString_RegionEquals(string, i, compare, length))
+            return i;
+    }
+
+    return BA_COMPACTSTRING_NOT_FOUND;
+}
+
+BA_Boolean BA_CompactString_Contains(const BA_CompactString* string, const wchar_t* compare) {
+    return BA_CompactString_Find(string, compare) != BA_COMPACTSTRING_NOT_FOUND;
+}
+
+BA_Boolean BA_CompactString_Append(BA_CompactString** target, const wchar_t* stringToAppend) {
+    BA_CompactString* string = *target;
+    size_t length = wcslen(stringToAppend);
+    size_t newLength = string->length + length;
+    int neededWidth = BA_CompactString_GetNeededWidth(stringToAppend, length);
+
+    if (neededWidth > string->width) {
+        BA_CompactString* widened = BA_CompactString_Allocate(newLength, neededWidth);
+
+        if (widened == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        BA_COMPACTSTRING_FOR_WIDTH(neededWidth, {
+            type* data = BA_COMPACTSTRING_DATA(widened, type);
+
+            for (size_t i = 0; i < string->length; i++)
+                data[i] = (type) BA_CompactString_GetCharacter(string, i);
+        });
+
+        widened->length = string->length;
+
+        free(string);
+
+        string = widened;
+    } else if (newLength > string->capacity) {
+        size_t capacity = string->capacity * 2 > newLength ? string->capacity * 2 : newLength;
+        BA_CompactString* grown = realloc(string, sizeof(BA_CompactString) + capacity * string->width);
+
+        if (grown == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        string = grown;
+        string->capacity = capacity;
+    }
+
+    BA_CompactString_Store(string, string->length, stringToAppend, length);
+
+    string->length = newLength;
+    *target = string;
+    return BA_BOOLEAN_TRUE;
+}
+
+wchar_t* BA_CompactString_ToWideString(const BA_CompactString* string) {
+    wchar_t* wideString = malloc((string->length + 1) * sizeof(wchar_t));
+
+    if (wideString == NULL)
+        return NULL;
+
+    if ((size_t) string->width == sizeof(wchar_t)) {
+        memcpy(wideString, string->data, string->length * sizeof(wchar_t));
+    } else {
+        BA_COMPACTSTRING_FOR_WIDTH(string->width, {
+            const type* data = BA_COMPACTSTRING_DATA(string, const type);
+
+            for (size_t i = 0; i < string->length; i++)
+                wideString[i] = (wchar_t) data[i];
+        });
+    }
+
+    wideString[string->length] = L'\0';
+    return wideString;
+}
+
+char* BA_CompactString_ToString(const BA_CompactString* string) {
+    if (string->width == 1 && BA_Unicode_IsASCII((const char*) string->data, string->length)) {
+        char* result = malloc(string->length + 1);
+
+        if (result == NULL)
+            return NULL;
+
+        memcpy(result, string->data, string->length);
+
+        result[string->length] = '\0';
+        return result;
+    }
+
+    wchar_t* wideString = BA_CompactString_ToWideString(string);
+
+    if (wideString == NULL)
+        return NULL;
+
+#if WCHAR_MAX > 0xFFFF
+    size_t size = BA_Unicode_GetUTF8LengthFromUTF32((const uint32_t*) wideString, string->length);
+#else
+    size_t size = BA_Unicode_GetUTF8LengthFromUTF16((const uint16_t*) wideString, string->length);
+#endif
+    char* result = size != BA_UNICODE_ERROR ? malloc(size + 1) : NULL;
+
+    if (result != NULL) {
+#if WCHAR_MAX > 0xFFFF
+        BA_Unicode_UTF32ToUTF8((const uint32_t*) wideString, string->length, result);
+#else
+        BA_Unicode_UTF16ToUTF8((const uint16_t*) wideString, string->length, result);
+#endif
+
+        result[size] = '\0';
+    }
+
+    free(wideString);
+    return result;
+}
+
+size_t BA_CompactString_GetMemoryUsage(const BA_CompactString* string) {
+    return sizeof(BA_CompactString) + string->capacity * string->width;
+}
+
+void BA_CompactString_Free(BA_CompactString* string) {
+    free(string);
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
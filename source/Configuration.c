@@ -1,101 +1,797 @@
 // Copyright (c) 2024, PortalPlayer <email@portalplayer.xyz>
 // Licensed under MIT <https://opensource.org/licenses/MIT>
 
+#include "BaconAPI/OperatingSystem.h"
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+#   define _DEFAULT_SOURCE // st_mtim
+#   include <sys/stat.h>
+#elif BA_OPERATINGSYSTEM_WINDOWS
+#   include <sys/stat.h>
+#endif
+
+#include <stdio.h>
 #include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <math.h>
 
 #include "BaconAPI/String.h"
+#include "BaconAPI/Hash.h"
+#include "BaconAPI/MappedFile.h"
 #include "BaconAPI/Logger.h"
-#include "BaconAPI/Storage/DynamicArray.h"
 #include "BaconAPI/Debugging/Assert.h"
+#include "BaconAPI/Atomic.h"
+#include "BaconAPI/Thread.h"
 #include "BaconAPI/Configuration.h"
+#include "ConfigurationInternal.h"
+
+#define BA_CONFIGURATION_IMAGE_MAGIC "BACNCFG"
+#define BA_CONFIGURATION_IMAGE_VERSION 1
+#define BA_CONFIGURATION_IMAGE_BYTE_ORDER 0x01020304
+#define BA_CONFIGURATION_ALIGN(size) (((size) + 15) & ~(size_t) 15)
+#define BA_CONFIGURATION_MINIMUM_CHUNK_SIZE (256 * 1024) // Anything smaller isn't worth starting a thread for
+#define BA_CONFIGURATION_MAXIMUM_CHUNKS 64
+#define BA_CONFIGURATION_IS_PARSED_TEXT(index, pointer) ((uintptr_t) (pointer) >= (uintptr_t) (index)->text && (uintptr_t) (pointer) <= (uintptr_t) (index)->text + (index)->textLength)
 
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
-static BA_Boolean BA_Configuration_AddLine(BA_DynamicDictionary* results, char* line, intmax_t length) {
-    if (length == -2) {
-        failed:
+typedef struct {
+    uint32_t hash; // Only the low half, it's just to skip most of the string compares
+    int index; // -1 if empty
+} BA_Configuration_IndexSlot;
+
+typedef struct {
+    BA_Atomic_Integer state; // Zero if empty, one while it's being filled, two if valid, three if invalid
+    union {
+        int64_t integer;
+        uint64_t unsignedInteger;
+        double floatingPoint;
+        BA_Boolean boolean;
+    } value;
+} BA_Configuration_CacheEntry;
+
+typedef struct {
+    int used;
+    unsigned int keyModifications; // From when this was built. If the keys changed since, it can't be trusted anymore
+    unsigned int valueModifications; // Same, but only for the cache
+    void** keys;
+    size_t mask;
+    BA_Configuration_IndexSlot* exactSlots;
+    BA_Configuration_IndexSlot* caselessSlots;
+    void* slotAllocation; // Only set if the slots couldn't be put in the same allocation as the text
+    const char* text; // Every key, and value, we parsed points in here
+    size_t textLength;
+    BA_Configuration_CacheEntry* cache; // One for each key, and type, only allocated once something asks for a typed value
+    BA_MappedFile* image; // The text, and slots, live in here if this was loaded from a compiled image
+} BA_Configuration_Index;
+
+/**
+ * Compiled images are this, the entries, the exact slots, the caseless slots, then every key and value one after another
+ * @note Hashes, and numbers, are stored the way this machine likes them. Images are meant to be made on the machine
+ *       using them
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder; // Images from a machine with the other byte order won't match
+    uint32_t entryAmount;
+    uint32_t slotAmount;
+    int64_t sourceModified;
+    int64_t sourceSize;
+    uint64_t textLength;
+    uint64_t checksum; // Everything after the header
+} BA_Configuration_ImageHeader;
+
+typedef struct {
+    uint32_t key; // Offsets into the text
+    uint32_t value;
+} BA_Configuration_ImageEntry;
+
+typedef struct {
+    const char* data;
+    char* text; // This chunk's part of the shared text
+    size_t length;
+    void** keys;
+    void** values;
+    uint32_t* hashes; // The exact, then caseless, hash of each key
+    int used;
+    BA_Boolean failed;
+} BA_Configuration_Chunk;
+
+/**
+ * Everything the parser makes, besides the key and value arrays, is one allocation. The slots, and the text, come after
+ * this. Parsing on threads gives the slots their own allocation, since how many are needed isn't known until the end
+ */
+typedef struct {
+    BA_DynamicDictionary dictionary; // Has to be first, this is what the user gets
+    BA_Configuration_Index index;
+} BA_Configuration_Block;
+
+static uint64_t BA_Configuration_HashCaseless(const char* key, size_t length) {
+    char folded[BA_HASH_BUFFER_SIZE];
+
+    if (length <= sizeof(folded)) {
+        for (size_t i = 0; i < length; i++)
+            folded[i] = (char) tolower((unsigned char) key[i]);
+
+        return BA_Hash_Bytes(folded, length);
+    }
+
+    // Gives the same hash as hashing it all at once, without needing a copy of the whole key
+    BA_Hash_State state;
+
+    BA_Hash_Start(&state, 0);
+
+    for (size_t offset = 0; offset < length; offset += sizeof(folded)) {
+        size_t amount = length - offset < sizeof(folded) ? length - offset : sizeof(folded);
+
+        for (size_t i = 0; i < amount; i++)
+            folded[i] = (char) tolower((unsigned char) key[offset + i]);
+
+        BA_Hash_Update(&state, folded, amount);
+    }
+
+    return BA_Hash_Finish(&state);
+}
+
+static BA_Boolean BA_Configuration_KeyEquals(const char* key, const char* compare, size_t length, BA_Boolean caseless) {
+    if (!caseless)
+        return strncmp(key, compare, length) == 0 && key[length] == '\0';
+
+    for (size_t i = 0; i < length; i++) {
+        if (tolower((unsigned char) key[i]) != tolower((unsigned char) compare[i]))
+            return BA_BOOLEAN_FALSE;
+    }
+
+    return key[length] == '\0';
+}
+
+static BA_Configuration_IndexSlot* BA_Configuration_FindSlot(const BA_Configuration_Index* index, BA_Configuration_IndexSlot* slots,
+                                                              const char* key, size_t length, uint64_t hash, BA_Boolean caseless) {
+    for (size_t i = hash & index->mask;; i = (i + 1) & index->mask) {
+        BA_Configuration_IndexSlot* slot = &slots[i];
+
+        if (slot->index == -1 || (slot->hash == (uint32_t) hash && BA_Configuration_KeyEquals(index->keys[slot->index], key, length, caseless)))
+            return slot;
+    }
+}
+
+static size_t BA_Configuration_GetSlotAmount(int keyAmount) {
+    size_t slotAmount = 16;
+
+    // Keeps at least half of them empty, so probing stays short
+    while (slotAmount < (size_t) keyAmount * 2)
+        slotAmount *= 2;
+
+    return slotAmount;
+}
+
+static void BA_Configuration_InsertKey(BA_Configuration_Index* index, int keyIndex, uint64_t hash, uint64_t caselessHash) {
+    const char* key = index->keys[keyIndex];
+    size_t length = strlen(key);
+    BA_Configuration_IndexSlot* slot = BA_Configuration_FindSlot(index, index->exactSlots, key, length, hash, BA_BOOLEAN_FALSE);
+
+    // Duplicates keep pointing at the first one, same as going through them in order would
+    if (slot->index == -1) {
+        slot->hash = (uint32_t) hash;
+        slot->index = keyIndex;
+    }
+
+    slot = BA_Configuration_FindSlot(index, index->caselessSlots, key, length, caselessHash, BA_BOOLEAN_TRUE);
+
+    if (slot->index == -1) {
+        slot->hash = (uint32_t) caselessHash;
+        slot->index = keyIndex;
+    }
+}
+
+static void BA_Configuration_ClearSlots(BA_Configuration_Index* index) {
+    for (size_t i = 0; i < (index->mask + 1) * 2; i++)
+        index->exactSlots[i].index = -1;
+}
+
+static void BA_Configuration_BuildIndex(BA_Configuration_Index* index) {
+    BA_Configuration_ClearSlots(index);
+
+    for (int i = 0; i < index->used; i++) {
+        const char* key = index->keys[i];
+        size_t length = strlen(key);
+
+        BA_Configuration_InsertKey(index, i, BA_Hash_Bytes(key, length), BA_Configuration_HashCaseless(key, length));
+    }
+}
+
+static int BA_Configuration_CountLines(const char* data, size_t length) {
+    int lineAmount = 1;
+
+    for (const char* newline = data; (newline = memchr(newline, '\n', length - (size_t) (newline - data))) != NULL; newline++)
+        lineAmount++;
+
+    return lineAmount;
+}
+
+/**
+ * Cuts keys, and values, out of the text in place. Nothing gets allocated
+ * @return How many keys were found
+ */
+static int BA_Configuration_Tokenize(char* text, char* textEnd, void** keys, void** values) {
+    int used = 0;
+
+    for (char* line = text; line < textEnd;) {
+        char* lineEnd = memchr(line, '\n', (size_t) (textEnd - line));
+
+        if (lineEnd == NULL)
+            lineEnd = textEnd;
+
+        char* nextLine = lineEnd + 1;
+
+        if (lineEnd > line && lineEnd[-1] == '\r')
+            lineEnd--;
+
+        *lineEnd = '\0';
+
+        if (lineEnd - line >= 2 && (line[0] != '/' || line[1] != '/')) {
+            char* equals = memchr(line, '=', (size_t) (lineEnd - line));
+            char* value = lineEnd; // No equals sign means an empty value
+
+            if (equals != NULL) {
+                *equals = '\0';
+                value = equals + 1;
+            }
+
+            if (*line != '\0') {
+                keys[used] = line;
+                values[used] = value;
+                used++;
+            }
+        }
+
+        line = nextLine;
+    }
+
+    return used;
+}
+
+static BA_DynamicDictionary* BA_Configuration_ParseBuffer(const char* data, size_t length) {
+    int lineAmount = BA_Configuration_CountLines(data, length);
+
+    // Every line could be a key, but only the slots that end up being needed get touched
+    size_t textOffset = BA_CONFIGURATION_ALIGN(sizeof(BA_Configuration_Block));
+    size_t slotsOffset = textOffset + BA_CONFIGURATION_ALIGN(length + 1);
+    BA_Configuration_Block* block = malloc(slotsOffset + BA_Configuration_GetSlotAmount(lineAmount) * 2 * sizeof(BA_Configuration_IndexSlot));
+
+    BA_ASSERT(block != NULL, "Failed to allocate memory for configuration results\n");
+
+    // Whatever the dictionary didn't get to allocate stays NULL, so it can all be freed
+    memset(&block->dictionary, 0, sizeof(block->dictionary));
+
+    if (!BA_DynamicDictionary_Create(&block->dictionary, (size_t) lineAmount)) {
         BA_LOGGER_TRACE("Failed to allocate memory for configuration buffer\n");
+        free(block->dictionary.keys.internalArray);
+        free(block->dictionary.values.internalArray);
+        free(block);
+        return NULL;
+    }
+
+    BA_DynamicDictionary* results = &block->dictionary;
+    char* text = (char*) block + textOffset;
+    char* textEnd = text + length;
+
+    memcpy(text, data, length);
+
+    *textEnd = '\0';
+    results->keys.used = BA_Configuration_Tokenize(text, textEnd, results->keys.internalArray, results->values.internalArray);
+    results->values.used = results->keys.used;
+    block->index.used = results->keys.used;
+    block->index.keyModifications = results->keys.modifications;
+    block->index.valueModifications = results->values.modifications;
+    block->index.keys = results->keys.internalArray;
+    block->index.mask = BA_Configuration_GetSlotAmount(results->keys.used) - 1;
+    block->index.exactSlots = (BA_Configuration_IndexSlot*) ((char*) block + slotsOffset);
+    block->index.caselessSlots = block->index.exactSlots + block->index.mask + 1;
+    block->index.slotAllocation = NULL;
+    block->index.text = text;
+    block->index.textLength = length;
+    block->index.cache = NULL;
+    block->index.image = NULL;
+    results->lookupIndex = &block->index;
+
+    BA_Configuration_BuildIndex(&block->index);
+    return results;
+}
+
+static void BA_Configuration_ParseChunk(void* argument) {
+    BA_Configuration_Chunk* chunk = argument;
+    int lineAmount = BA_Configuration_CountLines(chunk->data, chunk->length);
+
+    chunk->keys = malloc(sizeof(void*) * (size_t) lineAmount);
+    chunk->values = malloc(sizeof(void*) * (size_t) lineAmount);
+    chunk->hashes = malloc(sizeof(uint32_t) * 2 * (size_t) lineAmount);
+
+    if (chunk->keys == NULL || chunk->values == NULL || chunk->hashes == NULL) {
+        chunk->failed = BA_BOOLEAN_TRUE;
+        return;
+    }
 
-        for (int j = 0; j < results->keys.used; j++) {
-            free(results->keys.internalArray[j]);
-            free(results->values.internalArray[j]);
+    memcpy(chunk->text, chunk->data, chunk->length);
+
+    chunk->used = BA_Configuration_Tokenize(chunk->text, chunk->text + chunk->length, chunk->keys, chunk->values);
+
+    // Hashing is most of the work left after this, so it gets done here instead of while merging
+    for (int i = 0; i < chunk->used; i++) {
+        const char* key = chunk->keys[i];
+        size_t length = strlen(key);
+
+        chunk->hashes[i * 2] = (uint32_t) BA_Hash_Bytes(key, length);
+        chunk->hashes[i * 2 + 1] = (uint32_t) BA_Configuration_HashCaseless(key, length);
+    }
+}
+
+static void BA_Configuration_FreeChunks(BA_Configuration_Chunk* chunks, int chunkAmount) {
+    for (int i = 0; i < chunkAmount; i++) {
+        free(chunks[i].keys);
+        free(chunks[i].values);
+        free(chunks[i].hashes);
+    }
+}
+
+/**
+ * Each chunk gets its own part of the text, so threads never touch the same memory. The results are joined together in
+ * the same order as the text, so duplicate keys act the same as they would parsing it all at once
+ */
+static BA_DynamicDictionary* BA_Configuration_ParseChunks(const char* data, size_t length, int chunkAmount) {
+    size_t textOffset = BA_CONFIGURATION_ALIGN(sizeof(BA_Configuration_Block));
+    BA_Configuration_Block* block = malloc(textOffset + length + 1);
+
+    BA_ASSERT(block != NULL, "Failed to allocate memory for configuration results\n");
+    memset(&block->dictionary, 0, sizeof(block->dictionary));
+
+    char* text = (char*) block + textOffset;
+    BA_Configuration_Chunk chunks[BA_CONFIGURATION_MAXIMUM_CHUNKS];
+    BA_Thread threads[BA_CONFIGURATION_MAXIMUM_CHUNKS];
+    BA_Boolean threaded[BA_CONFIGURATION_MAXIMUM_CHUNKS];
+    size_t start = 0;
+
+    text[length] = '\0';
+
+    for (int i = 0; i < chunkAmount; i++) {
+        size_t end = length;
+
+        // Chunks end right after a line break, so no line gets split between two of them
+        if (i != chunkAmount - 1) {
+            size_t target = length / (size_t) chunkAmount * (size_t) (i + 1);
+            const char* newline;
+
+            if (target < start)
+                target = start;
+
+            newline = memchr(data + target, '\n', length - target);
+
+            if (newline != NULL)
+                end = (size_t) (newline - data) + 1;
         }
 
-        free(results->keys.internalArray);
-        free(results->values.internalArray);
-        free(results);
-        return BA_BOOLEAN_FALSE;
+        chunks[i].data = data + start;
+        chunks[i].text = text + start;
+        chunks[i].length = end - start;
+        chunks[i].keys = NULL;
+        chunks[i].values = NULL;
+        chunks[i].hashes = NULL;
+        chunks[i].used = 0;
+        chunks[i].failed = BA_BOOLEAN_FALSE;
+        start = end;
     }
-    
-    if (length < 2 || (line[0] == '/' && line[1] == '/'))
-        return BA_BOOLEAN_TRUE;
 
-    BA_DynamicArray* configurationInformation = BA_String_SplitCharacter(line, '=');
+    // The calling thread takes the first chunk, along with any that a thread couldn't be made for
+    threaded[0] = BA_BOOLEAN_FALSE;
 
-    if (configurationInformation == NULL)
-        goto failed;
-    
-    if (configurationInformation->used == 0)
-        return BA_BOOLEAN_TRUE;
+    for (int i = 1; i < chunkAmount; i++)
+        threaded[i] = BA_Thread_Create(&threads[i], &BA_Configuration_ParseChunk, NULL, &chunks[i]);
 
-    char* value = BA_String_CreateEmpty();
+    for (int i = 0; i < chunkAmount; i++) {
+        if (!threaded[i])
+            BA_Configuration_ParseChunk(&chunks[i]);
+    }
 
-    for (int i = 1; i < configurationInformation->used; i++) {
-        value = BA_String_Append(value, BA_DYNAMICARRAY_GET_ELEMENT_POINTER(char, configurationInformation, i));
+    int keyAmount = 0;
+    BA_Boolean failed = BA_BOOLEAN_FALSE;
+
+    for (int i = 0; i < chunkAmount; i++) {
+        if (threaded[i])
+            BA_Thread_Join(threads[i], NULL);
 
-        free(configurationInformation->internalArray[i]);
+        keyAmount += chunks[i].used;
+        failed = failed || chunks[i].failed;
     }
 
-    BA_DynamicDictionary_AddElementToLast(results, BA_DYNAMICARRAY_GET_ELEMENT_POINTER(char, configurationInformation, 0), value);
-    free(configurationInformation->internalArray);
-    free(configurationInformation);
-    return BA_BOOLEAN_TRUE;
+    BA_Configuration_IndexSlot* slots = NULL;
+
+    if (!failed) {
+        slots = malloc(BA_Configuration_GetSlotAmount(keyAmount) * 2 * sizeof(BA_Configuration_IndexSlot));
+        failed = slots == NULL;
+    }
+
+    if (failed || !BA_DynamicDictionary_Create(&block->dictionary, keyAmount != 0 ? (size_t) keyAmount : 1)) {
+        BA_LOGGER_TRACE("Failed to allocate memory for configuration buffer\n");
+        free(block->dictionary.keys.internalArray);
+        free(block->dictionary.values.internalArray);
+        BA_Configuration_FreeChunks(chunks, chunkAmount);
+        free(slots);
+        free(block);
+        return NULL;
+    }
+
+    BA_DynamicDictionary* results = &block->dictionary;
+
+    block->index.used = keyAmount;
+    block->index.keyModifications = results->keys.modifications;
+    block->index.valueModifications = results->values.modifications;
+    block->index.keys = results->keys.internalArray;
+    block->index.mask = BA_Configuration_GetSlotAmount(keyAmount) - 1;
+    block->index.exactSlots = slots;
+    block->index.caselessSlots = slots + block->index.mask + 1;
+    block->index.slotAllocation = slots;
+    block->index.text = text;
+    block->index.textLength = length;
+    block->index.cache = NULL;
+    block->index.image = NULL;
+    results->lookupIndex = &block->index;
+
+    BA_Configuration_ClearSlots(&block->index);
+
+    for (int i = 0; i < chunkAmount; i++) {
+        int offset = results->keys.used;
+
+        memcpy(results->keys.internalArray + offset, chunks[i].keys, sizeof(void*) * (size_t) chunks[i].used);
+        memcpy(results->values.internalArray + offset, chunks[i].values, sizeof(void*) * (size_t) chunks[i].used);
+
+        results->keys.used += chunks[i].used;
+        results->values.used += chunks[i].used;
+
+        for (int j = 0; j < chunks[i].used; j++)
+            BA_Configuration_InsertKey(&block->index, offset + j, chunks[i].hashes[j * 2], chunks[i].hashes[j * 2 + 1]);
+    }
+
+    BA_Configuration_FreeChunks(chunks, chunkAmount);
+    return results;
+}
+
+static BA_DynamicDictionary* BA_Configuration_ParseWithThreads(const char* data, size_t length, int threadAmount) {
+    int chunkAmount = threadAmount > 0 ? threadAmount : BA_Thread_GetProcessorAmount();
+
+    if ((size_t) chunkAmount > length / BA_CONFIGURATION_MINIMUM_CHUNK_SIZE)
+        chunkAmount = (int) (length / BA_CONFIGURATION_MINIMUM_CHUNK_SIZE);
+
+    if (chunkAmount > BA_CONFIGURATION_MAXIMUM_CHUNKS)
+        chunkAmount = BA_CONFIGURATION_MAXIMUM_CHUNKS;
+
+    if (chunkAmount <= 1 || BA_Thread_IsSingleThreaded())
+        return BA_Configuration_ParseBuffer(data, length);
+
+    return BA_Configuration_ParseChunks(data, length, chunkAmount);
 }
 
 BA_DynamicDictionary* BA_Configuration_ParseFromFile(FILE* configurationFile) {
-    BA_DynamicDictionary* results = malloc(sizeof(BA_DynamicDictionary));
-    char* line;
-    intmax_t length;
-
-    BA_ASSERT(results != NULL, "Failed to allocate memory for configuration results\n");
-    BA_DynamicDictionary_Create(results, 100);
-    
-    while ((length = BA_String_GetLine(configurationFile, &line, NULL)) != -1) {
-        if (BA_Configuration_AddLine(results, line, length)) {
-            free(line);
-            continue;
-        }
+    long position = ftell(configurationFile);
+    BA_MappedFile* mappedFile = BA_MappedFile_OpenFile(configurationFile, BA_MAPPEDFILE_ACCESS_SEQUENTIAL);
 
-        free(line);
-        break;
+    if (mappedFile == NULL) {
+        BA_LOGGER_TRACE("Failed to read configuration file\n");
+        return NULL;
     }
 
+    const char* data = BA_MappedFile_GetData(mappedFile);
+    size_t length = BA_MappedFile_GetLength(mappedFile);
+
+    // Mapping starts at the beginning of the file, but whatever is before the file pointer was meant to be skipped. Reading
+    // it would've moved the file pointer to the end too
+    if (BA_MappedFile_IsMapped(mappedFile) && position > 0) {
+        size_t skipped = (size_t) position < length ? (size_t) position : length;
+
+        data += skipped;
+        length -= skipped;
+    }
+
+    if (BA_MappedFile_IsMapped(mappedFile))
+        fseek(configurationFile, 0, SEEK_END);
+
+    BA_DynamicDictionary* results = BA_Configuration_ParseWithThreads(data, length, length >= BA_CONFIGURATION_PARALLEL_THRESHOLD ? 0 : 1);
+
+    BA_MappedFile_Close(mappedFile);
     return results;
 }
 
 BA_DynamicDictionary* BA_Configuration_Parse(const char* configurationData) {
-    BA_DynamicDictionary* results = malloc(sizeof(BA_DynamicDictionary));
-    BA_DynamicArray* unparsedKeysValues = BA_String_SplitCharacter(configurationData, '\n');
-    BA_Boolean failed = BA_BOOLEAN_FALSE;
+    size_t length = strlen(configurationData);
 
-    BA_ASSERT(results != NULL, "Failed to allocate memory for configuration results\n");
-    BA_DynamicDictionary_Create(results, 100);
+    return BA_Configuration_ParseWithThreads(configurationData, length, length >= BA_CONFIGURATION_PARALLEL_THRESHOLD ? 0 : 1);
+}
 
-    for (int i = 0; i < unparsedKeysValues->used; i++) {
-        char* line = BA_DYNAMICARRAY_GET_ELEMENT_POINTER(char, unparsedKeysValues, i);
+BA_DynamicDictionary* BA_Configuration_ParseParallel(const char* configurationData, int threadAmount) {
+    return BA_Configuration_ParseWithThreads(configurationData, strlen(configurationData), threadAmount);
+}
 
-        if (!failed && BA_Configuration_AddLine(results, line, (intmax_t) strlen(line))) {
-            free(line);
-            continue;
+BA_Boolean BA_Configuration_GetFileState(const char* path, long long* modified, long long* size) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    struct stat information;
+
+    if (stat(path, &information) != 0) {
+        *modified = -1;
+        *size = -1;
+        return BA_BOOLEAN_FALSE;
+    }
+
+#   if BA_OPERATINGSYSTEM_APPLE
+    *modified = (long long) information.st_mtimespec.tv_sec * 1000000000 + information.st_mtimespec.tv_nsec;
+#   else
+    *modified = (long long) information.st_mtim.tv_sec * 1000000000 + information.st_mtim.tv_nsec;
+#   endif
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    struct _stat64 information;
+
+    if (_stat64(path, &information) != 0) {
+        *modified = -1;
+        *size = -1;
+        return BA_BOOLEAN_FALSE;
+    }
+
+    *modified = (long long) information.st_mtime;
+#endif
+
+    *size = (long long) information.st_size;
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_Configuration_WriteFile(const char* path, const void* data, size_t length) {
+    // Written next to it first, so nobody loads half of a file
+    size_t pathLength = strlen(path);
+    char* temporaryPath = malloc(pathLength + sizeof(".tmp"));
+    FILE* file;
+
+    if (temporaryPath != NULL) {
+        memcpy(temporaryPath, path, pathLength);
+        memcpy(temporaryPath + pathLength, ".tmp", sizeof(".tmp"));
+    }
+
+    file = temporaryPath != NULL ? fopen(temporaryPath, "wb") : NULL;
+    BA_Boolean written = file != NULL && fwrite(data, 1, length, file) == length;
+
+    if (file != NULL && fclose(file) != 0)
+        written = BA_BOOLEAN_FALSE;
+
+#if BA_OPERATINGSYSTEM_WINDOWS
+    // Windows won't rename over a file that already exists
+    if (written)
+        remove(path);
+#endif
+
+    if (written && rename(temporaryPath, path) != 0)
+        written = BA_BOOLEAN_FALSE;
+
+    if (!written && file != NULL)
+        remove(temporaryPath);
+
+    free(temporaryPath);
+    return written;
+}
+
+static BA_Boolean BA_Configuration_CompileWithState(const BA_DynamicDictionary* parsedConfiguration, const char* imagePath, long long sourceModified, long long sourceSize) {
+    int entryAmount = parsedConfiguration->keys.used;
+    size_t slotAmount = BA_Configuration_GetSlotAmount(entryAmount);
+    size_t textLength = 0;
+
+    for (int i = 0; i < entryAmount; i++)
+        textLength += strlen(parsedConfiguration->keys.internalArray[i]) + strlen(parsedConfiguration->values.internalArray[i]) + 2;
+
+    if (textLength > UINT32_MAX)
+        return BA_BOOLEAN_FALSE;
+
+    size_t entriesOffset = sizeof(BA_Configuration_ImageHeader);
+    size_t slotsOffset = entriesOffset + (size_t) entryAmount * sizeof(BA_Configuration_ImageEntry);
+    size_t textOffset = slotsOffset + slotAmount * 2 * sizeof(BA_Configuration_IndexSlot);
+    char* image = calloc(1, textOffset + textLength);
+
+    if (image == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    BA_Configuration_ImageHeader* header = (BA_Configuration_ImageHeader*) image;
+    BA_Configuration_ImageEntry* entries = (BA_Configuration_ImageEntry*) (image + entriesOffset);
+    char* text = image + textOffset;
+    size_t textUsed = 0;
+
+    for (int i = 0; i < entryAmount; i++) {
+        size_t keyLength = strlen(parsedConfiguration->keys.internalArray[i]) + 1;
+        size_t valueLength = strlen(parsedConfiguration->values.internalArray[i]) + 1;
+
+        entries[i].key = (uint32_t) textUsed;
+        entries[i].value = (uint32_t) (textUsed + keyLength);
+
+        memcpy(text + textUsed, parsedConfiguration->keys.internalArray[i], keyLength);
+        memcpy(text + textUsed + keyLength, parsedConfiguration->values.internalArray[i], valueLength);
+
+        textUsed += keyLength + valueLength;
+    }
+
+    {
+        // Same slots a parsed configuration would have, so loading doesn't need to hash anything
+        BA_Configuration_Index index;
+
+        index.used = entryAmount;
+        index.keys = parsedConfiguration->keys.internalArray;
+        index.mask = slotAmount - 1;
+        index.exactSlots = (BA_Configuration_IndexSlot*) (image + slotsOffset);
+        index.caselessSlots = index.exactSlots + slotAmount;
+
+        BA_Configuration_BuildIndex(&index);
+    }
+
+    memcpy(header->magic, BA_CONFIGURATION_IMAGE_MAGIC, sizeof(header->magic));
+
+    header->version = BA_CONFIGURATION_IMAGE_VERSION;
+    header->byteOrder = BA_CONFIGURATION_IMAGE_BYTE_ORDER;
+    header->entryAmount = (uint32_t) entryAmount;
+    header->slotAmount = (uint32_t) slotAmount;
+    header->sourceModified = sourceModified;
+    header->sourceSize = sourceSize;
+    header->textLength = textLength;
+    header->checksum = BA_Hash_Bytes(image + sizeof(BA_Configuration_ImageHeader), textOffset + textLength - sizeof(BA_Configuration_ImageHeader));
+
+    BA_Boolean written = BA_Configuration_WriteFile(imagePath, image, textOffset + textLength);
+
+    free(image);
+    return written;
+}
+
+BA_Boolean BA_Configuration_Compile(const BA_DynamicDictionary* parsedConfiguration, const char* imagePath, const char* sourcePath) {
+    long long sourceModified = -1;
+    long long sourceSize = -1;
+
+    if (sourcePath != NULL && !BA_Configuration_GetFileState(sourcePath, &sourceModified, &sourceSize))
+        return BA_BOOLEAN_FALSE;
+
+    return BA_Configuration_CompileWithState(parsedConfiguration, imagePath, sourceModified, sourceSize);
+}
+
+BA_DynamicDictionary* BA_Configuration_LoadCompiled(const char* imagePath, const char* sourcePath) {
+    long long sourceModified = -1;
+    long long sourceSize = -1;
+
+    if (sourcePath != NULL && !BA_Configuration_GetFileState(sourcePath, &sourceModified, &sourceSize))
+        return NULL;
+
+    BA_MappedFile* image = BA_MappedFile_Open(imagePath, BA_MAPPEDFILE_ACCESS_RANDOM);
+
+    if (image == NULL)
+        return NULL;
+
+    const char* data = BA_MappedFile_GetData(image);
+    size_t length = BA_MappedFile_GetLength(image);
+    const BA_Configuration_ImageHeader* header = (const BA_Configuration_ImageHeader*) data;
+    size_t slotsOffset = sizeof(BA_Configuration_ImageHeader);
+    size_t textOffset = length + 1;
+
+    // Measured against what's left, so a huge amount can't wrap around into something that looks right
+    if (length >= sizeof(BA_Configuration_ImageHeader) && header->entryAmount <= (length - slotsOffset) / sizeof(BA_Configuration_ImageEntry)) {
+        slotsOffset += (size_t) header->entryAmount * sizeof(BA_Configuration_ImageEntry);
+
+        if (header->slotAmount <= (length - slotsOffset) / (2 * sizeof(BA_Configuration_IndexSlot)))
+            textOffset = slotsOffset + (size_t) header->slotAmount * 2 * sizeof(BA_Configuration_IndexSlot);
+    }
+
+    if (length < sizeof(BA_Configuration_ImageHeader) || memcmp(header->magic, BA_CONFIGURATION_IMAGE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != BA_CONFIGURATION_IMAGE_VERSION || header->byteOrder != BA_CONFIGURATION_IMAGE_BYTE_ORDER ||
+        header->entryAmount > INT32_MAX / 2 || header->slotAmount != BA_Configuration_GetSlotAmount((int) header->entryAmount) ||
+        (sourcePath != NULL && (header->sourceModified != sourceModified || header->sourceSize != sourceSize)) ||
+        textOffset > length || header->textLength != length - textOffset || (header->textLength != 0 && data[length - 1] != '\0') ||
+        header->checksum != BA_Hash_Bytes(data + sizeof(BA_Configuration_ImageHeader), length - sizeof(BA_Configuration_ImageHeader))) {
+        BA_LOGGER_TRACE("Compiled configuration is invalid, or out of date\n");
+        BA_MappedFile_Close(image);
+        return NULL;
+    }
+
+    // The checksum only catches accidents. Lookups trust the slots, so they get checked the same as everything else
+    {
+        const BA_Configuration_IndexSlot* slots = (const BA_Configuration_IndexSlot*) (data + slotsOffset);
+
+        for (int table = 0; table < 2; table++) {
+            uint32_t emptySlots = 0;
+            BA_Boolean valid = BA_BOOLEAN_TRUE;
+
+            for (uint32_t i = 0; i < header->slotAmount; i++) {
+                int index = slots[table * header->slotAmount + i].index;
+
+                if (index == -1)
+                    emptySlots++;
+                else if (index < 0 || (uint32_t) index >= header->entryAmount)
+                    valid = BA_BOOLEAN_FALSE;
+            }
+
+            // Probing stops at the first empty slot, so there has to be one
+            if (!valid || emptySlots == 0) {
+                BA_LOGGER_TRACE("Compiled configuration is invalid, or out of date\n");
+                BA_MappedFile_Close(image);
+                return NULL;
+            }
+        }
+    }
+
+    BA_Configuration_Block* block = calloc(1, sizeof(BA_Configuration_Block));
+    int entryAmount = (int) header->entryAmount;
+
+    if (block == NULL || !BA_DynamicDictionary_Create(&block->dictionary, entryAmount != 0 ? (size_t) entryAmount : 1)) {
+        if (block != NULL) {
+            free(block->dictionary.keys.internalArray);
+            free(block->dictionary.values.internalArray);
         }
 
-        failed = BA_BOOLEAN_TRUE;
+        free(block);
+        BA_MappedFile_Close(image);
+        return NULL;
+    }
+
+    const BA_Configuration_ImageEntry* entries = (const BA_Configuration_ImageEntry*) (data + sizeof(BA_Configuration_ImageHeader));
+    const char* text = data + textOffset;
 
-        free(line);
+    // Only the key, and value, arrays have to be filled in. Nothing gets parsed, or hashed
+    for (int i = 0; i < entryAmount; i++) {
+        if (entries[i].key >= header->textLength || entries[i].value >= header->textLength) {
+            BA_LOGGER_TRACE("Compiled configuration is invalid, or out of date\n");
+            free(block->dictionary.keys.internalArray);
+            free(block->dictionary.values.internalArray);
+            free(block);
+            BA_MappedFile_Close(image);
+            return NULL;
+        }
+
+        block->dictionary.keys.internalArray[i] = (char*) text + entries[i].key;
+        block->dictionary.values.internalArray[i] = (char*) text + entries[i].value;
     }
 
-    free(unparsedKeysValues->internalArray);
-    free(unparsedKeysValues);
-    return !failed ? results : NULL;
+    block->dictionary.keys.used = entryAmount;
+    block->dictionary.values.used = entryAmount;
+    block->index.used = entryAmount;
+    block->index.keyModifications = block->dictionary.keys.modifications;
+    block->index.valueModifications = block->dictionary.values.modifications;
+    block->index.keys = block->dictionary.keys.internalArray;
+    block->index.mask = header->slotAmount - 1;
+    block->index.exactSlots = (BA_Configuration_IndexSlot*) (data + slotsOffset);
+    block->index.caselessSlots = block->index.exactSlots + header->slotAmount;
+    block->index.slotAllocation = NULL;
+    block->index.text = text;
+    block->index.textLength = (size_t) header->textLength;
+    block->index.cache = NULL;
+    block->index.image = image;
+    block->dictionary.lookupIndex = &block->index;
+    return &block->dictionary;
+}
+
+BA_DynamicDictionary* BA_Configuration_ParseFromFileCached(const char* sourcePath, const char* imagePath) {
+    BA_DynamicDictionary* results = BA_Configuration_LoadCompiled(imagePath, sourcePath);
+    long long sourceModified;
+    long long sourceSize;
+
+    if (results != NULL)
+        return results;
+
+    // Checked before reading, so a change while we're parsing makes the image stale instead of wrong
+    if (!BA_Configuration_GetFileState(sourcePath, &sourceModified, &sourceSize))
+        return NULL;
+
+    FILE* file = fopen(sourcePath, "rb");
+
+    if (file == NULL)
+        return NULL;
+
+    results = BA_Configuration_ParseFromFile(file);
+
+    fclose(file);
+
+    if (results != NULL && !BA_Configuration_CompileWithState(results, imagePath, sourceModified, sourceSize))
+        BA_LOGGER_WARN("Failed to write compiled configuration to %s\n", imagePath);
+
+    return results;
 }
 
 // NOTE: This doesn't use any getter functions from DynamicDictionary, since DynamicDictionary assumes each key has the same size
@@ -107,8 +803,18 @@ char* BA_Configuration_GetValue(const BA_DynamicDictionary* parsedConfiguration,
 }
 
 int BA_Configuration_GetIndex(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless) {
+    const BA_Configuration_Index* index = parsedConfiguration->lookupIndex;
+    size_t length = strlen(key);
+
+    if (index != NULL && index->keyModifications == parsedConfiguration->keys.modifications) {
+        uint64_t hash = caseless ? BA_Configuration_HashCaseless(key, length) : BA_Hash_Bytes(key, length);
+
+        return BA_Configuration_FindSlot(index, caseless ? index->caselessSlots : index->exactSlots, key, length, hash, caseless)->index;
+    }
+
+    // Not made by us, or changed since
     for (int i = 0; i < parsedConfiguration->keys.used; i++) {
-        if (!BA_String_Equals(BA_DYNAMICARRAY_GET_ELEMENT(char, parsedConfiguration->keys, i), key, caseless))
+        if (!BA_Configuration_KeyEquals(BA_DYNAMICARRAY_GET_ELEMENT(char, parsedConfiguration->keys, i), key, length, caseless))
             continue;
 
         return i;
@@ -117,12 +823,289 @@ int BA_Configuration_GetIndex(const BA_DynamicDictionary* parsedConfiguration, c
     return -1;
 }
 
+static const char* baConfigurationTypeNames[] = {
+    "integer",
+    "unsigned integer",
+    "number",
+    "boolean",
+    "duration",
+    "size",
+    "string"
+};
+
+/**
+ * Parses the number at the start of value, skipping whitespace
+ * @return Where the number ended, or NULL if there's no number
+ */
+static const char* BA_Configuration_ParseNumber(const char* value, double* number) {
+    char* end;
+
+    errno = 0;
+    *number = strtod(value, &end);
+    return end != value && errno == 0 && isfinite(*number) ? end : NULL;
+}
+
+static BA_Boolean BA_Configuration_IsEnd(const char* string) {
+    while (isspace((unsigned char) *string))
+        string++;
+
+    return *string == '\0';
+}
+
+static BA_Boolean BA_Configuration_UnitEquals(const char* unit, size_t length, const char* compare) {
+    return strlen(compare) == length && BA_Configuration_KeyEquals(compare, unit, length, BA_BOOLEAN_TRUE);
+}
+
+/**
+ * @return Zero if the unit isn't one of units
+ */
+static double BA_Configuration_ParseUnit(const char* unit, const char* const* units, const double* multipliers, int unitAmount) {
+    size_t length;
+
+    while (isspace((unsigned char) *unit))
+        unit++;
+
+    for (length = 0; isalpha((unsigned char) unit[length]); length++)
+        continue;
+
+    if (!BA_Configuration_IsEnd(unit + length))
+        return 0;
+
+    for (int i = 0; i < unitAmount; i++) {
+        if (BA_Configuration_UnitEquals(unit, length, units[i]))
+            return multipliers[i];
+    }
+
+    return 0;
+}
+
+static BA_Boolean BA_Configuration_ParseWithUnit(const char* value, const char* const* units, const double* multipliers, int unitAmount, uint64_t* result) {
+    double number;
+    const char* end = BA_Configuration_ParseNumber(value, &number);
+    double multiplier = end != NULL ? BA_Configuration_ParseUnit(end, units, multipliers, unitAmount) : 0;
+
+    // 2^64, anything at, or above, this doesn't fit
+    if (multiplier == 0 || number < 0 || number * multiplier >= 18446744073709551616.0)
+        return BA_BOOLEAN_FALSE;
+
+    *result = (uint64_t) (number * multiplier + 0.5);
+    return BA_BOOLEAN_TRUE;
+}
+
+/**
+ * Decimal, unless it starts with 0x. A leading zero isn't octal, nobody writing a configuration means that
+ */
+static int BA_Configuration_GetBase(const char* value) {
+    while (isspace((unsigned char) *value))
+        value++;
+
+    if (*value == '-' || *value == '+')
+        value++;
+
+    return value[0] == '0' && (value[1] == 'x' || value[1] == 'X') ? 16 : 10;
+}
+
+static BA_Boolean BA_Configuration_ParseTyped(const char* value, BA_Configuration_Type type, BA_Configuration_CacheEntry* entry) {
+    static const char* booleanNames[] = {"false", "no", "off", "0", "true", "yes", "on", "1"};
+    static const char* durationUnits[] = {"", "ms", "s", "m", "h", "d"};
+    static const double durationMultipliers[] = {1, 1, 1000, 60000, 3600000, 86400000};
+    static const char* sizeUnits[] = {"", "b", "k", "kb", "kib", "m", "mb", "mib", "g", "gb", "gib", "t", "tb", "tib"};
+    static const double sizeMultipliers[] = {1, 1, 1024.0, 1024.0, 1024.0, 1048576.0, 1048576.0, 1048576.0, 1073741824.0, 1073741824.0, 1073741824.0,
+                                             1099511627776.0, 1099511627776.0, 1099511627776.0};
+    char* end;
+
+    errno = 0;
+
+    switch (type) {
+        case BA_CONFIGURATION_TYPE_INTEGER:
+            entry->value.integer = strtoll(value, &end, BA_Configuration_GetBase(value));
+            return end != value && errno == 0 && BA_Configuration_IsEnd(end);
+
+        case BA_CONFIGURATION_TYPE_UNSIGNED:
+            // strtoull happily takes negative numbers, and wraps them around
+            while (isspace((unsigned char) *value))
+                value++;
+
+            entry->value.unsignedInteger = strtoull(value, &end, BA_Configuration_GetBase(value));
+            return *value != '-' && end != value && errno == 0 && BA_Configuration_IsEnd(end);
+
+        case BA_CONFIGURATION_TYPE_DOUBLE:
+            end = (char*) BA_Configuration_ParseNumber(value, &entry->value.floatingPoint);
+            return end != NULL && BA_Configuration_IsEnd(end);
+
+        case BA_CONFIGURATION_TYPE_BOOLEAN:
+            while (isspace((unsigned char) *value))
+                value++;
+
+            for (int i = 0; i < (int) (sizeof(booleanNames) / sizeof(booleanNames[0])); i++) {
+                size_t length = strlen(booleanNames[i]);
+
+                if (!BA_Configuration_KeyEquals(booleanNames[i], value, length, BA_BOOLEAN_TRUE) || !BA_Configuration_IsEnd(value + length))
+                    continue;
+
+                entry->value.boolean = i >= 4;
+                return BA_BOOLEAN_TRUE;
+            }
+
+            return BA_BOOLEAN_FALSE;
+
+        case BA_CONFIGURATION_TYPE_DURATION:
+            return BA_Configuration_ParseWithUnit(value, durationUnits, durationMultipliers, (int) (sizeof(durationUnits) / sizeof(durationUnits[0])), &entry->value.unsignedInteger);
+
+        case BA_CONFIGURATION_TYPE_SIZE:
+            return BA_Configuration_ParseWithUnit(value, sizeUnits, sizeMultipliers, (int) (sizeof(sizeUnits) / sizeof(sizeUnits[0])), &entry->value.unsignedInteger);
+
+        default:
+            return BA_BOOLEAN_FALSE;
+    }
+}
+
+static void BA_Configuration_WriteTyped(const BA_Configuration_CacheEntry* entry, BA_Configuration_Type type, void* result) {
+    switch (type) {
+        case BA_CONFIGURATION_TYPE_INTEGER:
+            *(int64_t*) result = entry->value.integer;
+            break;
+
+        case BA_CONFIGURATION_TYPE_DOUBLE:
+            *(double*) result = entry->value.floatingPoint;
+            break;
+
+        case BA_CONFIGURATION_TYPE_BOOLEAN:
+            *(BA_Boolean*) result = entry->value.boolean;
+            break;
+
+        default:
+            *(uint64_t*) result = entry->value.unsignedInteger;
+            break;
+    }
+}
+
+static BA_Configuration_CacheEntry* BA_Configuration_GetCache(const BA_DynamicDictionary* parsedConfiguration, int keyIndex, BA_Configuration_Type type) {
+    BA_Configuration_Index* index = (BA_Configuration_Index*) parsedConfiguration->lookupIndex;
+    size_t entry = (size_t) keyIndex * BA_CONFIGURATION_TYPE_STRING + (size_t) type; // Strings never get cached
+
+    if (index == NULL || index->keyModifications != parsedConfiguration->keys.modifications ||
+        index->valueModifications != parsedConfiguration->values.modifications)
+        return NULL;
+
+    BA_Configuration_CacheEntry* cache = BA_ATOMIC_LOAD_POINTER(&index->cache);
+
+    if (cache != NULL)
+        return &cache[entry];
+
+    // Configurations can be shared between threads, so whoever gets here first wins
+    cache = calloc((size_t) index->used * BA_CONFIGURATION_TYPE_STRING, sizeof(BA_Configuration_CacheEntry));
+
+    if (cache == NULL)
+        return NULL;
+
+    if (!BA_ATOMIC_COMPARE_EXCHANGE_POINTER(&index->cache, NULL, cache)) {
+        free(cache);
+
+        cache = BA_ATOMIC_LOAD_POINTER(&index->cache);
+    }
+
+    return &cache[entry];
+}
+
+BA_Boolean BA_Configuration_GetTyped(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, BA_Configuration_Type type, void* result) {
+    int keyIndex = BA_Configuration_GetIndex(parsedConfiguration, key, caseless);
+
+    if (keyIndex == -1)
+        return BA_BOOLEAN_FALSE;
+
+    const char* value = BA_DYNAMICARRAY_GET_ELEMENT(char, parsedConfiguration->values, keyIndex);
+
+    if (type == BA_CONFIGURATION_TYPE_STRING) {
+        *(const char**) result = value;
+        return BA_BOOLEAN_TRUE;
+    }
+
+    BA_Configuration_CacheEntry* cached = BA_Configuration_GetCache(parsedConfiguration, keyIndex, type);
+    long state = cached != NULL ? BA_ATOMIC_LOAD(&cached->state) : 0;
+
+    if (state == 2) {
+        BA_Configuration_WriteTyped(cached, type, result);
+        return BA_BOOLEAN_TRUE;
+    }
+
+    if (state == 3)
+        return BA_BOOLEAN_FALSE;
+
+    BA_Configuration_CacheEntry entry;
+    BA_Boolean valid = BA_Configuration_ParseTyped(value, type, &entry);
+
+    if (!valid)
+        BA_LOGGER_ERROR("Configuration key \"%s\" should be a %s, but it's \"%s\"\n", key, baConfigurationTypeNames[type], value);
+
+    // Someone else might already be filling it in too
+    if (cached != NULL && state == 0 && BA_ATOMIC_COMPARE_EXCHANGE(&cached->state, 0, 1)) {
+        cached->value = entry.value;
+
+        BA_ATOMIC_STORE(&cached->state, valid ? 2 : 3);
+    }
+
+    if (valid)
+        BA_Configuration_WriteTyped(&entry, type, result);
+
+    return valid;
+}
+
+BA_Boolean BA_Configuration_GetInteger(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, int64_t* result) {
+    return BA_Configuration_GetTyped(parsedConfiguration, key, caseless, BA_CONFIGURATION_TYPE_INTEGER, result);
+}
+
+BA_Boolean BA_Configuration_GetUnsigned(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, uint64_t* result) {
+    return BA_Configuration_GetTyped(parsedConfiguration, key, caseless, BA_CONFIGURATION_TYPE_UNSIGNED, result);
+}
+
+BA_Boolean BA_Configuration_GetDouble(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, double* result) {
+    return BA_Configuration_GetTyped(parsedConfiguration, key, caseless, BA_CONFIGURATION_TYPE_DOUBLE, result);
+}
+
+BA_Boolean BA_Configuration_GetBoolean(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, BA_Boolean* result) {
+    return BA_Configuration_GetTyped(parsedConfiguration, key, caseless, BA_CONFIGURATION_TYPE_BOOLEAN, result);
+}
+
+BA_Boolean BA_Configuration_GetDuration(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, uint64_t* milliseconds) {
+    return BA_Configuration_GetTyped(parsedConfiguration, key, caseless, BA_CONFIGURATION_TYPE_DURATION, milliseconds);
+}
+
+BA_Boolean BA_Configuration_GetSize(const BA_DynamicDictionary* parsedConfiguration, const char* key, BA_Boolean caseless, uint64_t* bytes) {
+    return BA_Configuration_GetTyped(parsedConfiguration, key, caseless, BA_CONFIGURATION_TYPE_SIZE, bytes);
+}
+
+int BA_Configuration_Bind(const BA_DynamicDictionary* parsedConfiguration, const BA_Configuration_Field* fields, int fieldAmount, void* structure, BA_Boolean caseless) {
+    int set = 0;
+
+    for (int i = 0; i < fieldAmount; i++) {
+        if (BA_Configuration_GetTyped(parsedConfiguration, fields[i].key, caseless, fields[i].type, (char*) structure + fields[i].offset))
+            set++;
+    }
+
+    return set;
+}
+
 void BA_Configuration_Free(BA_DynamicDictionary* parsedConfiguration) {
+    const BA_Configuration_Index* index = parsedConfiguration->lookupIndex;
+
+    // Only free what was added afterward, everything we parsed lives in the same allocation as the dictionary
     for (int i = 0; i < parsedConfiguration->keys.used; i++) {
-        free(parsedConfiguration->keys.internalArray[i]);
-        free(parsedConfiguration->values.internalArray[i]);
+        if (index == NULL || !BA_CONFIGURATION_IS_PARSED_TEXT(index, parsedConfiguration->keys.internalArray[i]))
+            free(parsedConfiguration->keys.internalArray[i]);
+
+        if (index == NULL || !BA_CONFIGURATION_IS_PARSED_TEXT(index, parsedConfiguration->values.internalArray[i]))
+            free(parsedConfiguration->values.internalArray[i]);
     }
 
+    if (index != NULL) {
+        free(index->cache);
+        free(index->slotAllocation);
+    }
+
+    if (index != NULL && index->image != NULL)
+        BA_MappedFile_Close(index->image);
+
     free(parsedConfiguration->keys.internalArray);
     free(parsedConfiguration->values.internalArray);
     free(parsedConfiguration);
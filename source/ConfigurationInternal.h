@@ -0,0 +1,27 @@
+// Purpose: Configuration helpers shared with ConfigurationWatcher, and Translations
+// Created on: 10/19/26 @ 9:05 PM
+
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#pragma once
+
+#include <stddef.h>
+
+#include "BaconAPI/Internal/CPlusPlusSupport.h"
+#include "BaconAPI/Internal/Boolean.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * @param modified Some number that changes whenever the file is written to, -1 if the file doesn't exist
+ * @param size -1 if the file doesn't exist
+ * @return False if the file doesn't exist
+ */
+BA_Boolean BA_Configuration_GetFileState(const char* path, long long* modified, long long* size);
+
+/**
+ * Writes to a temporary file, then renames it over path. Nothing can see a half written file
+ * @return False if it failed to write, the old file is left alone
+ */
+BA_Boolean BA_Configuration_WriteFile(const char* path, const void* data, size_t length);
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
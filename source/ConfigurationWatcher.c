@@ -0,0 +1,410 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include "BaconAPI/OperatingSystem.h"
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+#   define _DEFAULT_SOURCE
+#   include <time.h>
+#   include <sched.h>
+#   if BA_OPERATINGSYSTEM_LINUX
+#       include <sys/inotify.h>
+#       include <poll.h>
+#       include <unistd.h>
+#   endif
+#elif BA_OPERATINGSYSTEM_WINDOWS
+#   include <Windows.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BaconAPI/ConfigurationWatcher.h"
+#include "BaconAPI/Configuration.h"
+#include "BaconAPI/Thread.h"
+#include "BaconAPI/Atomic.h"
+#include "BaconAPI/String.h"
+#include "BaconAPI/Internal/Compiler.h"
+#include "ConfigurationInternal.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef struct {
+    char* key; // NULL means every key
+    BA_ConfigurationWatcher_ChangeFunction function;
+    void* argument;
+} BA_ConfigurationWatcher_Listener;
+
+typedef struct BA_ConfigurationWatcher_Retired {
+    BA_DynamicDictionary* configuration;
+    long epoch; // Readers that started at this epoch, or later, can't have it
+    struct BA_ConfigurationWatcher_Retired* next;
+} BA_ConfigurationWatcher_Retired;
+
+struct BA_ConfigurationWatcher {
+    char* path;
+    const char* fileName;
+    BA_DynamicDictionary* current;
+    BA_Atomic_Integer epoch;
+    BA_Atomic_Integer readers[BA_CONFIGURATIONWATCHER_MAXIMUM_READERS]; // The epoch the reader started at, zero if unused
+    BA_ConfigurationWatcher_Retired* retired;
+    BA_Thread_Lock lock; // Only for reloading, and listeners. Readers don't touch it
+    BA_DynamicArray listeners;
+    BA_Atomic_Integer stopping;
+    BA_Boolean watching;
+    BA_Thread thread;
+#if BA_OPERATINGSYSTEM_LINUX
+    int inotifyDescriptor;
+#endif
+    long long lastModified;
+    long long lastSize;
+};
+
+static BA_COMPILER_THREAD_LOCAL int baConfigurationWatcherReaderHint = 0;
+
+static void BA_ConfigurationWatcher_Sleep(int milliseconds) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    struct timespec time = {milliseconds / 1000, (long) (milliseconds % 1000) * 1000000};
+
+    nanosleep(&time, NULL);
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    Sleep((DWORD) milliseconds);
+#endif
+}
+
+/**
+ * @return True if the file might have changed
+ */
+static BA_Boolean BA_ConfigurationWatcher_WaitForChange(BA_ConfigurationWatcher* watcher) {
+#if BA_OPERATINGSYSTEM_LINUX
+    if (watcher->inotifyDescriptor != -1) {
+        struct pollfd descriptor = {watcher->inotifyDescriptor, POLLIN, 0};
+        BA_Boolean changed = BA_BOOLEAN_FALSE;
+        char events[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+        if (poll(&descriptor, 1, BA_CONFIGURATIONWATCHER_INTERVAL) <= 0)
+            return BA_BOOLEAN_FALSE;
+
+        ssize_t length = read(watcher->inotifyDescriptor, events, sizeof(events));
+
+        // We watch the directory, since editors like to replace the file instead of writing to it
+        for (ssize_t offset = 0; offset < length;) {
+            const struct inotify_event* event = (const struct inotify_event*) (events + offset);
+
+            if (event->len != 0 && strcmp(event->name, watcher->fileName) == 0)
+                changed = BA_BOOLEAN_TRUE;
+
+            offset += (ssize_t) (sizeof(struct inotify_event) + event->len);
+        }
+
+        return changed;
+    }
+#endif
+
+    long long modified;
+    long long size;
+
+    BA_ConfigurationWatcher_Sleep(BA_CONFIGURATIONWATCHER_INTERVAL);
+    BA_Configuration_GetFileState(watcher->path, &modified, &size);
+
+    if (modified == watcher->lastModified && size == watcher->lastSize)
+        return BA_BOOLEAN_FALSE;
+
+    watcher->lastModified = modified;
+    watcher->lastSize = size;
+    return BA_BOOLEAN_TRUE;
+}
+
+/**
+ * @note Has to be called with the lock held
+ */
+static void BA_ConfigurationWatcher_Reclaim(BA_ConfigurationWatcher* watcher) {
+    long oldest = 0;
+
+    for (int i = 0; i < BA_CONFIGURATIONWATCHER_MAXIMUM_READERS; i++) {
+        long epoch = BA_ATOMIC_LOAD(&watcher->readers[i]);
+
+        if (epoch != 0 && (oldest == 0 || epoch < oldest))
+            oldest = epoch;
+    }
+
+    BA_ConfigurationWatcher_Retired** link = &watcher->retired;
+
+    while (*link != NULL) {
+        BA_ConfigurationWatcher_Retired* retired = *link;
+
+        if (oldest != 0 && oldest < retired->epoch) {
+            link = &retired->next;
+            continue;
+        }
+
+        *link = retired->next;
+
+        BA_Configuration_Free(retired->configuration);
+        free(retired);
+    }
+}
+
+static void BA_ConfigurationWatcher_CallListeners(BA_ConfigurationWatcher* watcher, const char* key, const char* oldValue, const char* newValue) {
+    for (int i = 0; i < watcher->listeners.used; i++) {
+        BA_ConfigurationWatcher_Listener* listener = BA_DYNAMICARRAY_GET_ELEMENT(BA_ConfigurationWatcher_Listener, watcher->listeners, i);
+
+        if (listener->key != NULL && strcmp(listener->key, key) != 0)
+            continue;
+
+        listener->function(key, oldValue, newValue, listener->argument);
+    }
+}
+
+/**
+ * @note Has to be called with the lock held
+ */
+static void BA_ConfigurationWatcher_CallChangedListeners(BA_ConfigurationWatcher* watcher, const BA_DynamicDictionary* oldConfiguration, const BA_DynamicDictionary* newConfiguration) {
+    if (watcher->listeners.used == 0)
+        return;
+
+    // Duplicate keys only count the first time, since that's the one lookups find
+    for (int i = 0; i < newConfiguration->keys.used; i++) {
+        const char* key = BA_DYNAMICARRAY_GET_ELEMENT(char, newConfiguration->keys, i);
+
+        if (BA_Configuration_GetIndex(newConfiguration, key, BA_BOOLEAN_FALSE) != i)
+            continue;
+
+        const char* oldValue = BA_Configuration_GetValue(oldConfiguration, key, BA_BOOLEAN_FALSE);
+        const char* newValue = BA_DYNAMICARRAY_GET_ELEMENT(char, newConfiguration->values, i);
+
+        if (oldValue == NULL || strcmp(oldValue, newValue) != 0)
+            BA_ConfigurationWatcher_CallListeners(watcher, key, oldValue, newValue);
+    }
+
+    for (int i = 0; i < oldConfiguration->keys.used; i++) {
+        const char* key = BA_DYNAMICARRAY_GET_ELEMENT(char, oldConfiguration->keys, i);
+
+        if (BA_Configuration_GetIndex(oldConfiguration, key, BA_BOOLEAN_FALSE) != i || BA_Configuration_GetIndex(newConfiguration, key, BA_BOOLEAN_FALSE) != -1)
+            continue;
+
+        BA_ConfigurationWatcher_CallListeners(watcher, key, BA_DYNAMICARRAY_GET_ELEMENT(char, oldConfiguration->values, i), NULL);
+    }
+}
+
+static BA_DynamicDictionary* BA_ConfigurationWatcher_Parse(const char* path) {
+    FILE* file = fopen(path, "rb");
+
+    if (file == NULL)
+        return NULL;
+
+    BA_DynamicDictionary* configuration = BA_Configuration_ParseFromFile(file);
+
+    fclose(file);
+    return configuration;
+}
+
+static void BA_ConfigurationWatcher_Watch(void* argument) {
+    BA_ConfigurationWatcher* watcher = argument;
+
+    while (!BA_ATOMIC_LOAD(&watcher->stopping)) {
+        if (BA_ConfigurationWatcher_WaitForChange(watcher)) {
+            BA_ConfigurationWatcher_Reload(watcher);
+            continue;
+        }
+
+        // Old versions get freed here too, otherwise they would stick around until the file changes again
+        if (!BA_Thread_UseLock(&watcher->lock))
+            continue;
+
+        BA_ConfigurationWatcher_Reclaim(watcher);
+        BA_Thread_Unlock(&watcher->lock);
+    }
+}
+
+BA_ConfigurationWatcher* BA_ConfigurationWatcher_Open(const char* path) {
+    BA_ConfigurationWatcher* watcher = calloc(1, sizeof(BA_ConfigurationWatcher));
+
+    if (watcher == NULL)
+        return NULL;
+
+    watcher->path = BA_String_Copy(path);
+    watcher->epoch = 1;
+
+    if (watcher->path == NULL || !BA_DynamicArray_Create(&watcher->listeners, 4)) {
+        free(watcher->path);
+        free(watcher);
+        return NULL;
+    }
+
+    if (!BA_Thread_CreateLock(&watcher->lock)) {
+        free(watcher->listeners.internalArray);
+        free(watcher->path);
+        free(watcher);
+        return NULL;
+    }
+
+    {
+        const char* slash = strrchr(watcher->path, '/');
+
+#if BA_OPERATINGSYSTEM_WINDOWS
+        const char* backslash = strrchr(watcher->path, '\\');
+
+        if (backslash != NULL && (slash == NULL || backslash > slash))
+            slash = backslash;
+#endif
+
+        watcher->fileName = slash != NULL ? slash + 1 : watcher->path;
+    }
+
+    BA_Configuration_GetFileState(watcher->path, &watcher->lastModified, &watcher->lastSize);
+
+    watcher->current = BA_ConfigurationWatcher_Parse(path);
+
+    if (watcher->current == NULL) {
+        BA_Thread_DestroyLock(&watcher->lock);
+        free(watcher->listeners.internalArray);
+        free(watcher->path);
+        free(watcher);
+        return NULL;
+    }
+
+#if BA_OPERATINGSYSTEM_LINUX
+    watcher->inotifyDescriptor = inotify_init1(IN_CLOEXEC);
+
+    if (watcher->inotifyDescriptor != -1) {
+        char* directory = watcher->fileName != watcher->path ? BA_String_Copy(watcher->path) : BA_String_Copy(".");
+
+        if (watcher->fileName != watcher->path && directory != NULL)
+            directory[watcher->fileName - watcher->path] = '\0';
+
+        // Only once the file is finished. Being created, or truncated, would publish it before anything is written
+        // Falls back to checking the modification time if we can't watch the directory
+        if (directory == NULL || inotify_add_watch(watcher->inotifyDescriptor, directory, IN_CLOSE_WRITE | IN_MOVED_TO) == -1) {
+            close(watcher->inotifyDescriptor);
+
+            watcher->inotifyDescriptor = -1;
+        }
+
+        free(directory);
+    }
+#endif
+
+    watcher->watching = BA_Thread_Create(&watcher->thread, &BA_ConfigurationWatcher_Watch, NULL, watcher);
+    return watcher;
+}
+
+void BA_ConfigurationWatcher_Close(BA_ConfigurationWatcher* watcher) {
+    if (watcher->watching) {
+        BA_ATOMIC_STORE(&watcher->stopping, BA_BOOLEAN_TRUE);
+        BA_Thread_Join(watcher->thread, NULL);
+    }
+
+#if BA_OPERATINGSYSTEM_LINUX
+    if (watcher->inotifyDescriptor != -1)
+        close(watcher->inotifyDescriptor);
+#endif
+
+    BA_ConfigurationWatcher_Reclaim(watcher);
+
+    for (int i = 0; i < watcher->listeners.used; i++) {
+        BA_ConfigurationWatcher_Listener* listener = BA_DYNAMICARRAY_GET_ELEMENT(BA_ConfigurationWatcher_Listener, watcher->listeners, i);
+
+        free(listener->key);
+        free(listener);
+    }
+
+    BA_Configuration_Free(watcher->current);
+    BA_Thread_DestroyLock(&watcher->lock);
+    free(watcher->listeners.internalArray);
+    free(watcher->path);
+    free(watcher);
+}
+
+const BA_DynamicDictionary* BA_ConfigurationWatcher_AcquireSnapshot(BA_ConfigurationWatcher* watcher, int* reader) {
+    for (int attempt = 1;; attempt++) {
+        int i = (baConfigurationWatcherReaderHint + attempt - 1) % BA_CONFIGURATIONWATCHER_MAXIMUM_READERS;
+
+        if (BA_ATOMIC_LOAD(&watcher->readers[i]) != 0 || !BA_ATOMIC_COMPARE_EXCHANGE(&watcher->readers[i], 0, BA_ATOMIC_LOAD(&watcher->epoch))) {
+            // Every slot is being used, let the other readers finish
+            if (attempt % BA_CONFIGURATIONWATCHER_MAXIMUM_READERS == 0) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+                sched_yield();
+#elif BA_OPERATINGSYSTEM_WINDOWS
+                SwitchToThread();
+#endif
+            }
+
+            continue;
+        }
+
+        // The reload thread either sees our epoch, or we see the new version. Never neither
+        BA_ATOMIC_FENCE();
+
+        baConfigurationWatcherReaderHint = i;
+        *reader = i;
+        return BA_ATOMIC_LOAD_POINTER(&watcher->current);
+    }
+}
+
+void BA_ConfigurationWatcher_ReleaseSnapshot(BA_ConfigurationWatcher* watcher, int reader) {
+    BA_ATOMIC_STORE(&watcher->readers[reader], 0);
+}
+
+BA_Boolean BA_ConfigurationWatcher_AddListener(BA_ConfigurationWatcher* watcher, const char* key, BA_ConfigurationWatcher_ChangeFunction function, void* argument) {
+    BA_ConfigurationWatcher_Listener* listener = malloc(sizeof(BA_ConfigurationWatcher_Listener));
+
+    if (listener == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    listener->key = key != NULL ? BA_String_Copy(key) : NULL;
+    listener->function = function;
+    listener->argument = argument;
+
+    if ((key != NULL && listener->key == NULL) || !BA_Thread_UseLock(&watcher->lock)) {
+        free(listener->key);
+        free(listener);
+        return BA_BOOLEAN_FALSE;
+    }
+
+    BA_Boolean added = BA_DynamicArray_AddElementToLast(&watcher->listeners, listener);
+
+    BA_Thread_Unlock(&watcher->lock);
+
+    if (!added) {
+        free(listener->key);
+        free(listener);
+    }
+
+    return added;
+}
+
+BA_Boolean BA_ConfigurationWatcher_Reload(BA_ConfigurationWatcher* watcher) {
+    // Parsing with the lock held means an older version can never replace a newer one
+    if (!BA_Thread_UseLock(&watcher->lock))
+        return BA_BOOLEAN_FALSE;
+
+    BA_DynamicDictionary* configuration = BA_ConfigurationWatcher_Parse(watcher->path);
+    BA_ConfigurationWatcher_Retired* retired = malloc(sizeof(BA_ConfigurationWatcher_Retired));
+
+    // The file is probably in the middle of being replaced, we'll hear about it again once it's done
+    if (configuration == NULL || retired == NULL) {
+        if (configuration != NULL)
+            BA_Configuration_Free(configuration);
+
+        free(retired);
+        BA_Thread_Unlock(&watcher->lock);
+        return BA_BOOLEAN_FALSE;
+    }
+
+    BA_DynamicDictionary* oldConfiguration = BA_ATOMIC_EXCHANGE_POINTER(&watcher->current, configuration);
+
+    // Anyone who started before this could still have the old version
+    BA_ATOMIC_FENCE();
+
+    retired->configuration = oldConfiguration;
+    retired->epoch = BA_ATOMIC_INCREMENT(&watcher->epoch);
+    retired->next = watcher->retired;
+    watcher->retired = retired;
+
+    BA_ConfigurationWatcher_CallChangedListeners(watcher, oldConfiguration, configuration);
+    BA_ConfigurationWatcher_Reclaim(watcher);
+    BA_Thread_Unlock(&watcher->lock);
+    return BA_BOOLEAN_TRUE;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,221 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+
+#include "BaconAPI/FileStream.h"
+#include "BaconAPI/LineReader.h"
+#include "BaconAPI/Thread.h"
+#include "BaconAPI/Atomic.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef struct {
+    char* data;
+    intmax_t length; // -2 if reading failed
+    BA_Boolean last;
+} BA_FileStream_Buffer;
+
+struct BA_FileStream {
+    FILE* file;
+    size_t chunkSize;
+    BA_FileStream_Buffer buffers[2];
+    int readingIndex;
+    int consumingIndex;
+    BA_Boolean holding; // The consumer still has a buffer, and it'll be given back on the next call
+    BA_Boolean finished;
+    BA_Boolean readingAhead;
+    BA_Atomic_Integer stopping;
+    BA_Atomic_Integer failedIndex; // The buffer the reading thread couldn't wait for, -1 if it hasn't failed
+    BA_Thread thread;
+    BA_Thread_Semaphore freeBuffers;
+    BA_Thread_Semaphore filledBuffers;
+};
+
+static void BA_FileStream_ReadChunk(BA_FileStream* stream, BA_FileStream_Buffer* buffer) {
+    size_t amount = fread(buffer->data, sizeof(char), stream->chunkSize, stream->file);
+
+    buffer->length = ferror(stream->file) ? -2 : (intmax_t) amount;
+    buffer->last = amount < stream->chunkSize;
+}
+
+static void BA_FileStream_ReadAhead(void* argument) {
+    BA_FileStream* stream = argument;
+
+    while (BA_BOOLEAN_TRUE) {
+        // The consumer might still have the buffer, so it can't be marked as failed. Say which one never came instead
+        if (!BA_Thread_WaitSemaphore(&stream->freeBuffers)) {
+            BA_ATOMIC_STORE(&stream->failedIndex, stream->readingIndex);
+            BA_Thread_PostSemaphore(&stream->filledBuffers);
+            break;
+        }
+
+        if (BA_ATOMIC_LOAD(&stream->stopping))
+            break;
+
+        BA_FileStream_Buffer* buffer = &stream->buffers[stream->readingIndex];
+
+        BA_FileStream_ReadChunk(stream, buffer);
+        BA_Thread_PostSemaphore(&stream->filledBuffers);
+
+        if (buffer->last)
+            break;
+
+        stream->readingIndex ^= 1;
+    }
+}
+
+/**
+ * Only starts the thread once we know there's more than one chunk. Small files never need it
+ */
+static void BA_FileStream_StartReadingAhead(BA_FileStream* stream) {
+    if (!BA_Thread_CreateSemaphore(&stream->freeBuffers, 1))
+        return;
+
+    if (!BA_Thread_CreateSemaphore(&stream->filledBuffers, 0)) {
+        BA_Thread_DestroySemaphore(&stream->freeBuffers);
+        return;
+    }
+
+    stream->readingIndex = 1;
+    stream->consumingIndex = 1;
+
+    if (BA_Thread_Create(&stream->thread, &BA_FileStream_ReadAhead, NULL, stream)) {
+        stream->readingAhead = BA_BOOLEAN_TRUE;
+        return;
+    }
+
+    BA_Thread_DestroySemaphore(&stream->freeBuffers);
+    BA_Thread_DestroySemaphore(&stream->filledBuffers);
+}
+
+BA_FileStream* BA_FileStream_Open(FILE* file, size_t chunkSize) {
+    BA_FileStream* stream = malloc(sizeof(BA_FileStream));
+
+    if (stream == NULL)
+        return NULL;
+
+    stream->file = file;
+    stream->chunkSize = chunkSize != 0 ? chunkSize : BA_FILESTREAM_DEFAULT_CHUNK_SIZE;
+    stream->readingIndex = 0;
+    stream->consumingIndex = 0;
+    stream->holding = BA_BOOLEAN_FALSE;
+    stream->finished = BA_BOOLEAN_FALSE;
+    stream->readingAhead = BA_BOOLEAN_FALSE;
+    BA_ATOMIC_STORE(&stream->stopping, BA_BOOLEAN_FALSE);
+    BA_ATOMIC_STORE(&stream->failedIndex, -1);
+
+    for (int i = 0; i < 2; i++) {
+        stream->buffers[i].data = malloc(stream->chunkSize);
+        stream->buffers[i].length = 0;
+        stream->buffers[i].last = BA_BOOLEAN_FALSE;
+    }
+
+    if (stream->buffers[0].data == NULL || stream->buffers[1].data == NULL) {
+        free(stream->buffers[0].data);
+        free(stream->buffers[1].data);
+        free(stream);
+        return NULL;
+    }
+
+    return stream;
+}
+
+void BA_FileStream_Close(BA_FileStream* stream) {
+    if (stream == NULL)
+        return;
+
+    if (stream->readingAhead) {
+        BA_ATOMIC_STORE(&stream->stopping, BA_BOOLEAN_TRUE);
+
+        BA_Thread_PostSemaphore(&stream->freeBuffers);
+        BA_Thread_PostSemaphore(&stream->freeBuffers);
+        BA_Thread_Join(stream->thread, NULL);
+        BA_Thread_DestroySemaphore(&stream->freeBuffers);
+        BA_Thread_DestroySemaphore(&stream->filledBuffers);
+    }
+
+    free(stream->buffers[0].data);
+    free(stream->buffers[1].data);
+    free(stream);
+}
+
+intmax_t BA_FileStream_Next(BA_FileStream* stream, const char** chunk) {
+    BA_FileStream_Buffer* buffer;
+
+    if (stream->finished)
+        return -1;
+
+    if (stream->readingAhead) {
+        // Give back the last chunk, that's what lets the reading thread move on. Only one chunk can be waiting at a time,
+        // so the failed buffer is never mixed up with one that was read
+        if ((stream->holding && !BA_Thread_PostSemaphore(&stream->freeBuffers)) || !BA_Thread_WaitSemaphore(&stream->filledBuffers) ||
+            BA_ATOMIC_LOAD(&stream->failedIndex) == stream->consumingIndex) {
+            stream->finished = BA_BOOLEAN_TRUE;
+            return -2;
+        }
+
+        buffer = &stream->buffers[stream->consumingIndex];
+        stream->consumingIndex ^= 1;
+    } else {
+        buffer = &stream->buffers[0];
+
+        BA_FileStream_ReadChunk(stream, buffer);
+
+        if (!buffer->last && !stream->holding)
+            BA_FileStream_StartReadingAhead(stream);
+    }
+
+    stream->holding = BA_BOOLEAN_TRUE;
+    stream->finished = buffer->last || buffer->length == -2;
+
+    if (buffer->length == 0)
+        return -1;
+
+    if (chunk != NULL)
+        *chunk = buffer->data;
+
+    return buffer->length;
+}
+
+BA_Boolean BA_FileStream_IsReadingAhead(const BA_FileStream* stream) {
+    return stream->readingAhead;
+}
+
+BA_Boolean BA_FileStream_ForEachChunk(FILE* file, size_t chunkSize, BA_FileStream_ChunkFunction function, void* userData) {
+    BA_FileStream* stream = BA_FileStream_Open(file, chunkSize);
+    const char* chunk;
+    intmax_t length;
+
+    if (stream == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    while ((length = BA_FileStream_Next(stream, &chunk)) >= 0 && function(chunk, (size_t) length, userData))
+        continue;
+
+    BA_FileStream_Close(stream);
+    return length != -2;
+}
+
+BA_Boolean BA_FileStream_ForEachLine(FILE* file, const char* delimiter, BA_FileStream_LineFunction function, void* userData) {
+    BA_FileStream* stream = BA_FileStream_Open(file, 0);
+
+    if (stream == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    BA_LineReader* reader = BA_LineReader_CreateFromStream(stream, delimiter);
+    char* line;
+    intmax_t length;
+
+    if (reader == NULL) {
+        BA_FileStream_Close(stream);
+        return BA_BOOLEAN_FALSE;
+    }
+
+    while ((length = BA_LineReader_Next(reader, &line)) >= 0 && function(line, (size_t) length, userData))
+        continue;
+
+    BA_LineReader_Free(reader);
+    BA_FileStream_Close(stream);
+    return length != -2;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
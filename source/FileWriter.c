@@ -0,0 +1,492 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include "BaconAPI/OperatingSystem.h"
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+#   define _GNU_SOURCE // O_DIRECT
+#   include <sys/uio.h>
+#   include <unistd.h>
+#   include <fcntl.h>
+#   include <time.h>
+#elif BA_OPERATINGSYSTEM_WINDOWS
+#   include <Windows.h>
+#   include <io.h>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <limits.h>
+
+#include "BaconAPI/FileWriter.h"
+
+// O_DIRECT wants the buffer, length, and file position to all be lined up to the block size
+#define BA_FILEWRITER_ALIGNMENT 4096
+#define BA_FILEWRITER_MAXIMUM_SEGMENTS 64
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+struct BA_FileWriter {
+    int descriptor;
+    BA_Boolean ownsDescriptor;
+    BA_Boolean failed;
+    char* buffer;
+    size_t capacity;
+    size_t used;
+    BA_FileWriter_FlushPolicy flushPolicy;
+    size_t flushValue;
+    unsigned long long lastFlush; // Milliseconds
+    BA_FileWriter_Durability durability;
+    BA_Boolean direct; // O_DIRECT is currently on
+};
+
+static unsigned long long BA_FileWriter_GetMilliseconds(void) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (unsigned long long) time.tv_sec * 1000 + (unsigned long long) time.tv_nsec / 1000000;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    return GetTickCount64();
+#endif
+}
+
+/**
+ * Keeps going until everything is written, or it fails
+ */
+static BA_Boolean BA_FileWriter_WriteSegments(BA_FileWriter* writer, BA_FileWriter_Segment* segments, int amount) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    while (amount > 0) {
+        struct iovec vectors[BA_FILEWRITER_MAXIMUM_SEGMENTS];
+        int vectorAmount = amount < BA_FILEWRITER_MAXIMUM_SEGMENTS ? amount : BA_FILEWRITER_MAXIMUM_SEGMENTS;
+
+        for (int i = 0; i < vectorAmount; i++) {
+            vectors[i].iov_base = (void*) segments[i].data;
+            vectors[i].iov_len = segments[i].length;
+        }
+
+        ssize_t written = writev(writer->descriptor, vectors, vectorAmount);
+
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+
+            return BA_BOOLEAN_FALSE;
+        }
+
+        // Skip everything that got written, it might have stopped part way through a segment
+        while (amount > 0 && (size_t) written >= segments->length) {
+            written -= (ssize_t) segments->length;
+            segments++;
+            amount--;
+        }
+
+        if (amount > 0) {
+            segments->data = (const char*) segments->data + written;
+            segments->length -= (size_t) written;
+        }
+    }
+
+    return BA_BOOLEAN_TRUE;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    for (int i = 0; i < amount; i++) {
+        const char* data = segments[i].data;
+        size_t left = segments[i].length;
+
+        while (left > 0) {
+            int written = _write(writer->descriptor, data, left < INT_MAX ? (unsigned) left : INT_MAX);
+
+            if (written <= 0)
+                return BA_BOOLEAN_FALSE;
+
+            data += written;
+            left -= (size_t) written;
+        }
+    }
+
+    return BA_BOOLEAN_TRUE;
+#endif
+}
+
+static BA_Boolean BA_FileWriter_SetDirect(BA_FileWriter* writer, BA_Boolean enabled) {
+#if BA_OPERATINGSYSTEM_LINUX && defined(O_DIRECT)
+    int flags = fcntl(writer->descriptor, F_GETFL);
+
+    if (flags == -1)
+        return BA_BOOLEAN_FALSE;
+
+    if (enabled) {
+        // Appending always writes at the end, no matter what the position is
+        off_t position = lseek(writer->descriptor, 0, (flags & O_APPEND) ? SEEK_END : SEEK_CUR);
+
+        if (position == -1 || position % BA_FILEWRITER_ALIGNMENT != 0)
+            return BA_BOOLEAN_FALSE;
+    }
+
+    if (fcntl(writer->descriptor, F_SETFL, enabled ? flags | O_DIRECT : flags & ~O_DIRECT) == -1)
+        return BA_BOOLEAN_FALSE;
+#elif BA_OPERATINGSYSTEM_APPLE
+    if (fcntl(writer->descriptor, F_NOCACHE, enabled ? 1 : 0) == -1)
+        return BA_BOOLEAN_FALSE;
+#else
+    if (enabled)
+        return BA_BOOLEAN_FALSE;
+#endif
+
+    writer->direct = enabled;
+    return BA_BOOLEAN_TRUE;
+}
+
+static BA_Boolean BA_FileWriter_Sync(BA_FileWriter* writer) {
+#if BA_OPERATINGSYSTEM_APPLE
+    return fsync(writer->descriptor) == 0;
+#elif BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    return fdatasync(writer->descriptor) == 0;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    return FlushFileBuffers((HANDLE) _get_osfhandle(writer->descriptor)) != 0;
+#endif
+}
+
+/**
+ * Everything that was buffered is out, so start over
+ */
+static BA_Boolean BA_FileWriter_FinishFlush(BA_FileWriter* writer, BA_Boolean sync) {
+    writer->used = 0;
+    writer->lastFlush = BA_FileWriter_GetMilliseconds();
+
+    if (writer->durability != BA_FILEWRITER_DURABILITY_NONE && sync && !BA_FileWriter_Sync(writer)) {
+        writer->failed = BA_BOOLEAN_TRUE;
+        return BA_BOOLEAN_FALSE;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+/**
+ * @param extra Written right after the buffer, in the same call. Can be NULL
+ * @param everything In direct mode, only full blocks get written unless this is true
+ */
+static BA_Boolean BA_FileWriter_FlushBuffer(BA_FileWriter* writer, const BA_FileWriter_Segment* extra, BA_Boolean everything) {
+    BA_FileWriter_Segment segments[2];
+    int amount = 0;
+
+    if (writer->failed)
+        return BA_BOOLEAN_FALSE;
+
+    if (writer->direct) {
+        BA_FileWriter_Segment aligned = {writer->buffer, writer->used / BA_FILEWRITER_ALIGNMENT * BA_FILEWRITER_ALIGNMENT};
+
+        if (aligned.length != 0 && !BA_FileWriter_WriteSegments(writer, &aligned, 1)) {
+            // Some file systems say yes to O_DIRECT, and then refuse the writes
+            if (errno != EINVAL || !BA_FileWriter_SetDirect(writer, BA_BOOLEAN_FALSE)) {
+                writer->failed = BA_BOOLEAN_TRUE;
+                return BA_BOOLEAN_FALSE;
+            }
+
+            aligned.length = 0;
+        }
+
+        if (writer->direct) {
+            // The rest can't go out while O_DIRECT is on
+            memmove(writer->buffer, writer->buffer + aligned.length, writer->used - aligned.length);
+
+            writer->used -= aligned.length;
+
+            if (writer->used == 0)
+                return BA_FileWriter_FinishFlush(writer, everything);
+
+            if (!everything) {
+                writer->lastFlush = BA_FileWriter_GetMilliseconds();
+                return BA_BOOLEAN_TRUE;
+            }
+
+            BA_FileWriter_SetDirect(writer, BA_BOOLEAN_FALSE);
+        }
+    }
+
+    if (writer->used != 0) {
+        segments[amount].data = writer->buffer;
+        segments[amount].length = writer->used;
+        amount++;
+    }
+
+    if (extra != NULL && extra->length != 0)
+        segments[amount++] = *extra;
+
+    if (amount != 0 && !BA_FileWriter_WriteSegments(writer, segments, amount)) {
+        writer->failed = BA_BOOLEAN_TRUE;
+        return BA_BOOLEAN_FALSE;
+    }
+
+    return BA_FileWriter_FinishFlush(writer, everything);
+}
+
+static BA_Boolean BA_FileWriter_ApplyFlushPolicy(BA_FileWriter* writer) {
+    switch (writer->flushPolicy) {
+        case BA_FILEWRITER_FLUSH_POLICY_SIZE:
+            if (writer->used < writer->flushValue)
+                return BA_BOOLEAN_TRUE;
+
+            break;
+
+        case BA_FILEWRITER_FLUSH_POLICY_TIME:
+            if (BA_FileWriter_GetMilliseconds() - writer->lastFlush < writer->flushValue)
+                return BA_BOOLEAN_TRUE;
+
+            break;
+
+        default:
+            return BA_BOOLEAN_TRUE;
+    }
+
+    return BA_FileWriter_FlushBuffer(writer, NULL, BA_BOOLEAN_TRUE);
+}
+
+static BA_FileWriter* BA_FileWriter_Create(int descriptor, BA_Boolean ownsDescriptor, size_t bufferSize) {
+    BA_FileWriter* writer = malloc(sizeof(BA_FileWriter));
+
+    if (writer == NULL)
+        return NULL;
+
+    writer->capacity = bufferSize != 0 ? bufferSize : BA_FILEWRITER_DEFAULT_BUFFER_SIZE;
+    writer->capacity = (writer->capacity + BA_FILEWRITER_ALIGNMENT - 1) / BA_FILEWRITER_ALIGNMENT * BA_FILEWRITER_ALIGNMENT;
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    if (posix_memalign((void**) &writer->buffer, BA_FILEWRITER_ALIGNMENT, writer->capacity) != 0)
+        writer->buffer = NULL;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    writer->buffer = _aligned_malloc(writer->capacity, BA_FILEWRITER_ALIGNMENT);
+#endif
+
+    if (writer->buffer == NULL) {
+        free(writer);
+        return NULL;
+    }
+
+    writer->descriptor = descriptor;
+    writer->ownsDescriptor = ownsDescriptor;
+    writer->failed = BA_BOOLEAN_FALSE;
+    writer->used = 0;
+    writer->flushPolicy = BA_FILEWRITER_FLUSH_POLICY_MANUAL;
+    writer->flushValue = 0;
+    writer->lastFlush = BA_FileWriter_GetMilliseconds();
+    writer->durability = BA_FILEWRITER_DURABILITY_NONE;
+    writer->direct = BA_BOOLEAN_FALSE;
+    return writer;
+}
+
+BA_FileWriter* BA_FileWriter_Open(const char* path, BA_Boolean append, size_t bufferSize) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    int descriptor = open(path, O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC), 0666);
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    int descriptor = _open(path, _O_WRONLY | _O_CREAT | _O_BINARY | (append ? _O_APPEND : _O_TRUNC), _S_IREAD | _S_IWRITE);
+#endif
+
+    if (descriptor == -1)
+        return NULL;
+
+    BA_FileWriter* writer = BA_FileWriter_Create(descriptor, BA_BOOLEAN_TRUE, bufferSize);
+
+    if (writer == NULL) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+        close(descriptor);
+#elif BA_OPERATINGSYSTEM_WINDOWS
+        _close(descriptor);
+#endif
+    }
+
+    return writer;
+}
+
+BA_FileWriter* BA_FileWriter_OpenFile(FILE* file, size_t bufferSize) {
+    fflush(file);
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    return BA_FileWriter_Create(fileno(file), BA_BOOLEAN_FALSE, bufferSize);
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    return BA_FileWriter_Create(_fileno(file), BA_BOOLEAN_FALSE, bufferSize);
+#endif
+}
+
+BA_Boolean BA_FileWriter_Close(BA_FileWriter* writer) {
+    if (writer == NULL)
+        return BA_BOOLEAN_TRUE;
+
+    BA_Boolean succeeded = BA_FileWriter_FlushBuffer(writer, NULL, BA_BOOLEAN_TRUE);
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    if (writer->ownsDescriptor && close(writer->descriptor) != 0)
+        succeeded = BA_BOOLEAN_FALSE;
+
+    free(writer->buffer);
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    if (writer->ownsDescriptor && _close(writer->descriptor) != 0)
+        succeeded = BA_BOOLEAN_FALSE;
+
+    _aligned_free(writer->buffer);
+#endif
+
+    free(writer);
+    return succeeded;
+}
+
+void BA_FileWriter_SetFlushPolicy(BA_FileWriter* writer, BA_FileWriter_FlushPolicy policy, size_t value) {
+    writer->flushPolicy = policy;
+    writer->flushValue = policy == BA_FILEWRITER_FLUSH_POLICY_SIZE && value == 0 ? writer->capacity : value;
+}
+
+BA_Boolean BA_FileWriter_SetDurability(BA_FileWriter* writer, BA_FileWriter_Durability durability) {
+    if (!BA_FileWriter_FlushBuffer(writer, NULL, BA_BOOLEAN_TRUE))
+        return BA_BOOLEAN_FALSE;
+
+    if ((durability == BA_FILEWRITER_DURABILITY_DIRECT) != writer->direct &&
+        !BA_FileWriter_SetDirect(writer, durability == BA_FILEWRITER_DURABILITY_DIRECT))
+        return BA_BOOLEAN_FALSE;
+
+    writer->durability = durability;
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_FileWriter_Write(BA_FileWriter* writer, const void* data, size_t length) {
+    const char* position = data;
+
+    if (writer->failed)
+        return BA_BOOLEAN_FALSE;
+
+    if (length <= writer->capacity - writer->used) {
+        memcpy(writer->buffer + writer->used, data, length);
+
+        writer->used += length;
+        return BA_FileWriter_ApplyFlushPolicy(writer);
+    }
+
+    // Not worth copying, send it out right behind the buffer
+    if (!writer->direct && length >= writer->capacity / 2)
+        return BA_FileWriter_FlushBuffer(writer, &(BA_FileWriter_Segment) {data, length}, BA_BOOLEAN_TRUE);
+
+    while (length > 0) {
+        size_t amount = writer->capacity - writer->used < length ? writer->capacity - writer->used : length;
+
+        memcpy(writer->buffer + writer->used, position, amount);
+
+        writer->used += amount;
+        position += amount;
+        length -= amount;
+
+        if (writer->used == writer->capacity && !BA_FileWriter_FlushBuffer(writer, NULL, BA_BOOLEAN_FALSE))
+            return BA_BOOLEAN_FALSE;
+    }
+
+    return BA_FileWriter_ApplyFlushPolicy(writer);
+}
+
+BA_Boolean BA_FileWriter_WriteString(BA_FileWriter* writer, const char* string) {
+    return BA_FileWriter_Write(writer, string, strlen(string));
+}
+
+BA_Boolean BA_FileWriter_WriteCharacter(BA_FileWriter* writer, char character) {
+    if (writer->used == writer->capacity || writer->failed)
+        return BA_FileWriter_Write(writer, &character, 1);
+
+    writer->buffer[writer->used++] = character;
+    return BA_FileWriter_ApplyFlushPolicy(writer);
+}
+
+BA_Boolean BA_FileWriter_WriteFormat(BA_FileWriter* writer, const char* format, ...) {
+    va_list arguments;
+    size_t space = writer->capacity - writer->used;
+    int length;
+
+    if (writer->failed)
+        return BA_BOOLEAN_FALSE;
+
+    va_start(arguments, format);
+    length = vsnprintf(writer->buffer + writer->used, space, format, arguments);
+    va_end(arguments);
+
+    if (length < 0)
+        return BA_BOOLEAN_FALSE;
+
+    // vsnprintf needs room for the null terminator, even though we don't keep it
+    if ((size_t) length < space) {
+        writer->used += (size_t) length;
+        return BA_FileWriter_ApplyFlushPolicy(writer);
+    }
+
+    char* formatted = malloc((size_t) length + 1);
+
+    if (formatted == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    va_start(arguments, format);
+    vsnprintf(formatted, (size_t) length + 1, format, arguments);
+    va_end(arguments);
+
+    BA_Boolean succeeded = BA_FileWriter_Write(writer, formatted, (size_t) length);
+
+    free(formatted);
+    return succeeded;
+}
+
+BA_Boolean BA_FileWriter_WriteVector(BA_FileWriter* writer, const BA_FileWriter_Segment* segments, int amount) {
+    BA_FileWriter_Segment batch[BA_FILEWRITER_MAXIMUM_SEGMENTS];
+    int batchAmount = 0;
+
+    if (writer->failed)
+        return BA_BOOLEAN_FALSE;
+
+    if (writer->direct) {
+        for (int i = 0; i < amount; i++) {
+            if (!BA_FileWriter_Write(writer, segments[i].data, segments[i].length))
+                return BA_BOOLEAN_FALSE;
+        }
+
+        return BA_BOOLEAN_TRUE;
+    }
+
+    for (int i = 0; i < amount; i++) {
+        const BA_FileWriter_Segment* segment = &segments[i];
+
+        // Small ones get copied. Once a big one shows up, everything before it has to go out first to keep the order
+        if (batchAmount == 0 && segment->length <= writer->capacity - writer->used && segment->length < writer->capacity / 2) {
+            memcpy(writer->buffer + writer->used, segment->data, segment->length);
+
+            writer->used += segment->length;
+            continue;
+        }
+
+        if (batchAmount == 0 && writer->used != 0) {
+            batch[batchAmount].data = writer->buffer;
+            batch[batchAmount].length = writer->used;
+            batchAmount++;
+        }
+
+        batch[batchAmount++] = *segment;
+
+        if (batchAmount == BA_FILEWRITER_MAXIMUM_SEGMENTS || i == amount - 1) {
+            if (!BA_FileWriter_WriteSegments(writer, batch, batchAmount)) {
+                writer->failed = BA_BOOLEAN_TRUE;
+                return BA_BOOLEAN_FALSE;
+            }
+
+            if (!BA_FileWriter_FinishFlush(writer, BA_BOOLEAN_TRUE))
+                return BA_BOOLEAN_FALSE;
+
+            batchAmount = 0;
+        }
+    }
+
+    return BA_FileWriter_ApplyFlushPolicy(writer);
+}
+
+BA_Boolean BA_FileWriter_Flush(BA_FileWriter* writer) {
+    return BA_FileWriter_FlushBuffer(writer, NULL, BA_BOOLEAN_TRUE);
+}
+
+size_t BA_FileWriter_GetBuffered(const BA_FileWriter* writer) {
+    return writer->used;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,326 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+#include "BaconAPI/Glob.h"
+
+#define BA_GLOB_FOLD(glob, character) ((glob)->caseless ? (unsigned char) tolower((unsigned char) (character)) : (unsigned char) (character))
+#define BA_GLOB_CLASS_CONTAINS(characterClass, character) (((characterClass)[(character) >> 5] >> ((character) & 31)) & 1)
+#define BA_GLOB_CLASS_ADD(characterClass, character) (characterClass)[(character) >> 5] |= (uint32_t) 1 << ((character) & 31)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef enum {
+    BA_GLOB_OPERATION_LITERAL,
+    BA_GLOB_OPERATION_ANY,
+    BA_GLOB_OPERATION_CLASS
+} BA_Glob_Operation;
+
+typedef struct {
+    unsigned char operation;
+    unsigned char character; // Already folded if caseless
+    unsigned short classIndex;
+} BA_Glob_Instruction;
+
+/**
+ * Everything between two stars
+ */
+typedef struct {
+    int start;
+    int length;
+    BA_Boolean literal; // Only literal instructions, so we can use the faster search
+} BA_Glob_Segment;
+
+struct BA_Glob {
+    BA_Boolean caseless;
+    BA_Boolean anchoredStart; // Doesn't start with a star
+    BA_Boolean anchoredEnd; // Doesn't end with a star
+    size_t minimumLength;
+    int instructionAmount;
+    int segmentAmount;
+    int classAmount;
+    BA_Glob_Instruction* instructions;
+    char* literals; // Same index as instructions
+    BA_Glob_Segment* segments;
+    uint32_t (*classes)[8];
+};
+
+/**
+ * @return Where the class ends, NULL if it isn't closed
+ */
+static const char* BA_Glob_ParseClass(BA_Glob* glob, const char* pattern, BA_Boolean filling) {
+    uint32_t characterClass[8] = {0};
+    BA_Boolean negated = *pattern == '!' || *pattern == '^';
+
+    if (negated)
+        pattern++;
+
+    // A ] right at the start is part of the class
+    for (BA_Boolean first = BA_BOOLEAN_TRUE; *pattern != ']' || first; first = BA_BOOLEAN_FALSE) {
+        if (*pattern == '\0')
+            return NULL;
+
+        unsigned char start = (unsigned char) *pattern++;
+        unsigned char end = start;
+
+        if (*pattern == '-' && pattern[1] != ']' && pattern[1] != '\0') {
+            end = (unsigned char) pattern[1];
+            pattern += 2;
+        }
+
+        for (int character = start; character <= end; character++) {
+            BA_GLOB_CLASS_ADD(characterClass, character);
+
+            if (glob->caseless) {
+                BA_GLOB_CLASS_ADD(characterClass, tolower(character));
+                BA_GLOB_CLASS_ADD(characterClass, toupper(character));
+            }
+        }
+    }
+
+    if (filling) {
+        for (int i = 0; i < 8; i++)
+            glob->classes[glob->classAmount][i] = negated ? ~characterClass[i] : characterClass[i];
+    }
+
+    return pattern + 1;
+}
+
+/**
+ * Goes over the pattern once to count, and once more to fill everything in
+ */
+static void BA_Glob_Parse(BA_Glob* glob, const char* pattern, BA_Boolean filling) {
+    BA_Boolean inSegment = BA_BOOLEAN_FALSE;
+
+    glob->instructionAmount = 0;
+    glob->segmentAmount = 0;
+    glob->classAmount = 0;
+    glob->minimumLength = 0;
+    glob->anchoredStart = *pattern != '*';
+    glob->anchoredEnd = BA_BOOLEAN_TRUE;
+
+    while (*pattern != '\0') {
+        BA_Glob_Instruction instruction = {BA_GLOB_OPERATION_LITERAL, 0, 0};
+
+        if (*pattern == '*') {
+            inSegment = BA_BOOLEAN_FALSE;
+            glob->anchoredEnd = BA_BOOLEAN_FALSE;
+            pattern++;
+            continue;
+        }
+
+        glob->anchoredEnd = BA_BOOLEAN_TRUE;
+
+        if (*pattern == '?') {
+            instruction.operation = BA_GLOB_OPERATION_ANY;
+            pattern++;
+        } else if (*pattern == '[' && BA_Glob_ParseClass(glob, pattern + 1, BA_BOOLEAN_FALSE) != NULL) {
+            instruction.operation = BA_GLOB_OPERATION_CLASS;
+            instruction.classIndex = (unsigned short) glob->classAmount;
+            pattern = BA_Glob_ParseClass(glob, pattern + 1, filling);
+            glob->classAmount++;
+        } else {
+            if (*pattern == '\\' && pattern[1] != '\0')
+                pattern++;
+
+            instruction.character = BA_GLOB_FOLD(glob, *pattern);
+            pattern++;
+        }
+
+        if (!inSegment) {
+            if (filling) {
+                glob->segments[glob->segmentAmount].start = glob->instructionAmount;
+                glob->segments[glob->segmentAmount].length = 0;
+                glob->segments[glob->segmentAmount].literal = BA_BOOLEAN_TRUE;
+            }
+
+            glob->segmentAmount++;
+            inSegment = BA_BOOLEAN_TRUE;
+        }
+
+        if (filling) {
+            BA_Glob_Segment* segment = &glob->segments[glob->segmentAmount - 1];
+
+            segment->length++;
+            segment->literal = segment->literal && instruction.operation == BA_GLOB_OPERATION_LITERAL;
+            glob->instructions[glob->instructionAmount] = instruction;
+            glob->literals[glob->instructionAmount] = (char) instruction.character;
+        }
+
+        glob->instructionAmount++;
+        glob->minimumLength++;
+    }
+}
+
+static BA_Boolean BA_Glob_CompareLiteral(const BA_Glob* glob, const char* string, const char* literal, size_t length) {
+    if (!glob->caseless)
+        return memcmp(string, literal, length) == 0;
+
+    for (size_t i = 0; i < length; i++) {
+        if (BA_GLOB_FOLD(glob, string[i]) != (unsigned char) literal[i])
+            return BA_BOOLEAN_FALSE;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+static BA_Boolean BA_Glob_MatchSegmentAt(const BA_Glob* glob, const BA_Glob_Segment* segment, const char* string) {
+    if (segment->literal)
+        return BA_Glob_CompareLiteral(glob, string, glob->literals + segment->start, segment->length);
+
+    for (int i = 0; i < segment->length; i++) {
+        const BA_Glob_Instruction* instruction = &glob->instructions[segment->start + i];
+        unsigned char character = (unsigned char) string[i];
+
+        switch (instruction->operation) {
+            case BA_GLOB_OPERATION_LITERAL:
+                if (BA_GLOB_FOLD(glob, character) != instruction->character)
+                    return BA_BOOLEAN_FALSE;
+
+                break;
+
+            case BA_GLOB_OPERATION_CLASS:
+                if (!BA_GLOB_CLASS_CONTAINS(glob->classes[instruction->classIndex], character))
+                    return BA_BOOLEAN_FALSE;
+
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+/**
+ * @return Where the first match of segment starts, NULL if there is none
+ */
+static const char* BA_Glob_FindSegment(const BA_Glob* glob, const BA_Glob_Segment* segment, const char* string, const char* end) {
+    if (end - string < segment->length)
+        return NULL;
+
+    const char* last = end - segment->length;
+
+    // Jump straight to the first character, instead of trying every position
+    if (segment->literal && !glob->caseless) {
+        char first = glob->literals[segment->start];
+
+        while (string <= last && (string = memchr(string, first, last - string + 1)) != NULL) {
+            if (memcmp(string + 1, glob->literals + segment->start + 1, segment->length - 1) == 0)
+                return string;
+
+            string++;
+        }
+
+        return NULL;
+    }
+
+    for (; string <= last; string++) {
+        if (BA_Glob_MatchSegmentAt(glob, segment, string))
+            return string;
+    }
+
+    return NULL;
+}
+
+BA_Glob* BA_Glob_Compile(const char* pattern, BA_Boolean caseless) {
+    BA_Glob counting = {0};
+
+    counting.caseless = caseless;
+
+    BA_Glob_Parse(&counting, pattern, BA_BOOLEAN_FALSE);
+
+    // Everything lives in one allocation
+    size_t classesOffset = sizeof(BA_Glob);
+    size_t instructionsOffset = classesOffset + counting.classAmount * sizeof(uint32_t[8]);
+    size_t segmentsOffset = instructionsOffset + counting.instructionAmount * sizeof(BA_Glob_Instruction);
+    size_t literalsOffset = segmentsOffset + counting.segmentAmount * sizeof(BA_Glob_Segment);
+    char* memory = malloc(literalsOffset + counting.instructionAmount);
+
+    if (memory == NULL)
+        return NULL;
+
+    BA_Glob* glob = (BA_Glob*) memory;
+
+    glob->caseless = caseless;
+    glob->classes = (uint32_t (*)[8]) (memory + classesOffset);
+    glob->instructions = (BA_Glob_Instruction*) (memory + instructionsOffset);
+    glob->segments = (BA_Glob_Segment*) (memory + segmentsOffset);
+    glob->literals = memory + literalsOffset;
+
+    BA_Glob_Parse(glob, pattern, BA_BOOLEAN_TRUE);
+    return glob;
+}
+
+void BA_Glob_Free(BA_Glob* glob) {
+    free(glob);
+}
+
+BA_Boolean BA_Glob_Match(const BA_Glob* glob, const char* string) {
+    return BA_Glob_MatchLength(glob, string, strlen(string));
+}
+
+BA_Boolean BA_Glob_MatchLength(const BA_Glob* glob, const char* string, size_t length) {
+    if (length < glob->minimumLength)
+        return BA_BOOLEAN_FALSE;
+
+    if (glob->segmentAmount == 0)
+        return !glob->anchoredStart || length == 0;
+
+    const BA_Glob_Segment* first = glob->segments;
+    const BA_Glob_Segment* last = glob->segments + glob->segmentAmount - 1;
+    const char* position = string;
+    const char* end = string + length;
+
+    // No stars at all
+    if (glob->anchoredStart && glob->anchoredEnd && first == last)
+        return length == (size_t) first->length && BA_Glob_MatchSegmentAt(glob, first, string);
+
+    // Literal prefix, and suffix are just compared in place
+    if (glob->anchoredStart) {
+        if (!BA_Glob_MatchSegmentAt(glob, first, position))
+            return BA_BOOLEAN_FALSE;
+
+        position += first->length;
+        first++;
+    }
+
+    if (glob->anchoredEnd) {
+        // Can't overlap the prefix, minimumLength already made sure of that
+        end -= last->length;
+
+        if (!BA_Glob_MatchSegmentAt(glob, last, end))
+            return BA_BOOLEAN_FALSE;
+
+        last--;
+    }
+
+    // Every segment in the middle has a star on both sides, so the leftmost match is always the right one
+    for (; first <= last; first++) {
+        position = BA_Glob_FindSegment(glob, first, position, end);
+
+        if (position == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        position += first->length;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_Glob_MatchOnce(const char* pattern, const char* string, BA_Boolean caseless) {
+    BA_Glob* glob = BA_Glob_Compile(pattern, caseless);
+
+    if (glob == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    BA_Boolean result = BA_Glob_Match(glob, string);
+
+    BA_Glob_Free(glob);
+    return result;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
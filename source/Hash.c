@@ -0,0 +1,552 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+
+#include "BaconAPI/Hash.h"
+#include "BaconAPI/Atomic.h"
+#include "BaconAPI/Internal/Compiler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define BA_HASH_SSE2 1
+#   include <emmintrin.h>
+#else
+#   define BA_HASH_SSE2 0
+#endif
+
+// AVX2 is picked at runtime, so it needs a compiler that lets us target it per function
+#if BA_HASH_SSE2 && (BA_COMPILER_GCC || BA_COMPILER_CLANG)
+#   define BA_HASH_AVX2 1
+#   include <immintrin.h>
+#else
+#   define BA_HASH_AVX2 0
+#endif
+
+// Every 64-bit ARM CPU has NEON
+#if defined(__aarch64__) || defined(_M_ARM64)
+#   define BA_HASH_NEON 1
+#   include <arm_neon.h>
+#else
+#   define BA_HASH_NEON 0
+#endif
+
+#define BA_HASH_PRIME32_1 0x9E3779B1U
+#define BA_HASH_PRIME32_2 0x85EBCA77U
+#define BA_HASH_PRIME32_3 0xC2B2AE3DU
+#define BA_HASH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define BA_HASH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define BA_HASH_PRIME64_3 0x165667B19E3779F9ULL
+#define BA_HASH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define BA_HASH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+// Anything up to this size goes through the short hash
+#define BA_HASH_SHORT_LIMIT BA_HASH_BUFFER_SIZE
+
+#define BA_HASH_STRIPES_PER_BLOCK 16
+#define BA_HASH_SCRAMBLE_SECRET_OFFSET (BA_HASH_SECRET_SIZE - BA_HASH_STRIPE_SIZE)
+#define BA_HASH_LAST_STRIPE_SECRET_OFFSET (BA_HASH_SECRET_SIZE - BA_HASH_STRIPE_SIZE - 7)
+#define BA_HASH_MERGE_SECRET_OFFSET 11
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef void (*BA_Hash_AccumulateFunction)(uint64_t* accumulators, const unsigned char* input, const unsigned char* secret, size_t stripes);
+typedef void (*BA_Hash_ScrambleFunction)(uint64_t* accumulators, const unsigned char* secret);
+
+typedef struct {
+    BA_Hash_AccumulateFunction accumulate;
+    BA_Hash_ScrambleFunction scramble;
+    const char* name;
+} BA_Hash_Implementation;
+
+static const uint64_t baHashDefaultSecret[BA_HASH_SECRET_SIZE / sizeof(uint64_t)] = {
+    0x1F733CD593B32EBEULL, 0x8FB946E02B1DCB29ULL, 0xC5B2F4F59A35AF22ULL,
+    0x8000B4C229B40032ULL, 0x5E9FF4E7B0076449ULL, 0xC3E1285F329FFF8DULL,
+    0x9FAD292BDB11C72FULL, 0x3E2AF0B932BCB69EULL, 0x98FBC9CAA7D45227ULL,
+    0x1AD412F80BAF3569ULL, 0xF52E3F7C94A49E7EULL, 0xC1BED5391D2A3180ULL,
+    0x64D082D266C18F9FULL, 0x8F8125A49644E383ULL, 0x53FBCE6B2D84D460ULL,
+    0x8F45DCCFC84BD8DEULL, 0x37ABE06B6C5468A5ULL, 0x76DD7B982DEBB870ULL,
+    0xCF6C07C233CEE062ULL, 0x9CDD4A10539772ACULL, 0x2F21A0232BE4B4BAULL,
+    0x52B9C3D122FD5681ULL, 0x61A3634324284784ULL, 0x494B193DFCE077C9ULL
+};
+
+static const uint64_t baHashShortSecret[4] = {0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL};
+
+static const uint64_t baHashInitialAccumulators[8] = {
+    BA_HASH_PRIME32_3, BA_HASH_PRIME64_1, BA_HASH_PRIME64_2, BA_HASH_PRIME64_3,
+    BA_HASH_PRIME64_4, BA_HASH_PRIME32_2, BA_HASH_PRIME64_5, BA_HASH_PRIME32_1
+};
+
+static uint64_t BA_Hash_Read64(const unsigned char* pointer) {
+    uint64_t value;
+
+    memcpy(&value, pointer, sizeof(uint64_t));
+    return value;
+}
+
+static uint64_t BA_Hash_Read32(const unsigned char* pointer) {
+    uint32_t value;
+
+    memcpy(&value, pointer, sizeof(uint32_t));
+    return value;
+}
+
+/**
+ * @return Both halves of the 128-bit product xored together
+ */
+static uint64_t BA_Hash_Multiply(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128) a * b;
+
+    return (uint64_t) product ^ (uint64_t) (product >> 64);
+#else
+    uint64_t aLow = (uint32_t) a;
+    uint64_t aHigh = a >> 32;
+    uint64_t bLow = (uint32_t) b;
+    uint64_t bHigh = b >> 32;
+    uint64_t productLowLow = aLow * bLow;
+    uint64_t productLowHigh = aLow * bHigh;
+    uint64_t productHighLow = aHigh * bLow;
+    uint64_t productMiddle = (productLowLow >> 32) + (uint32_t) productLowHigh + (uint32_t) productHighLow;
+    uint64_t low = (productMiddle << 32) | (uint32_t) productLowLow;
+    uint64_t high = aHigh * bHigh + (productLowHigh >> 32) + (productHighLow >> 32) + (productMiddle >> 32);
+
+    return low ^ high;
+#endif
+}
+
+/**
+ * wyhash, fastest for small inputs
+ */
+static uint64_t BA_Hash_Short(const unsigned char* input, size_t length, uint64_t seed) {
+    uint64_t a;
+    uint64_t b;
+
+    seed ^= BA_Hash_Multiply(seed ^ baHashShortSecret[0], baHashShortSecret[1]);
+
+    if (length <= 16) {
+        if (length >= 4) {
+            size_t offset = (length >> 3) << 2;
+
+            a = (BA_Hash_Read32(input) << 32) | BA_Hash_Read32(input + offset);
+            b = (BA_Hash_Read32(input + length - 4) << 32) | BA_Hash_Read32(input + length - 4 - offset);
+        } else if (length > 0) {
+            a = ((uint64_t) input[0] << 16) | ((uint64_t) input[length >> 1] << 8) | input[length - 1];
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t left = length;
+
+        if (left >= 48) {
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+
+            do {
+                seed = BA_Hash_Multiply(BA_Hash_Read64(input) ^ baHashShortSecret[1], BA_Hash_Read64(input + 8) ^ seed);
+                seed1 = BA_Hash_Multiply(BA_Hash_Read64(input + 16) ^ baHashShortSecret[2], BA_Hash_Read64(input + 24) ^ seed1);
+                seed2 = BA_Hash_Multiply(BA_Hash_Read64(input + 32) ^ baHashShortSecret[3], BA_Hash_Read64(input + 40) ^ seed2);
+                input += 48;
+                left -= 48;
+            } while (left >= 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (left > 16) {
+            seed = BA_Hash_Multiply(BA_Hash_Read64(input) ^ baHashShortSecret[1], BA_Hash_Read64(input + 8) ^ seed);
+            input += 16;
+            left -= 16;
+        }
+
+        a = BA_Hash_Read64(input + left - 16);
+        b = BA_Hash_Read64(input + left - 8);
+    }
+
+    a ^= baHashShortSecret[1];
+    b ^= seed;
+
+#if defined(__SIZEOF_INT128__)
+    {
+        unsigned __int128 product = (unsigned __int128) a * b;
+
+        a = (uint64_t) product;
+        b = (uint64_t) (product >> 64);
+    }
+#else
+    {
+        uint64_t aLow = (uint32_t) a;
+        uint64_t aHigh = a >> 32;
+        uint64_t bLow = (uint32_t) b;
+        uint64_t bHigh = b >> 32;
+        uint64_t productLowLow = aLow * bLow;
+        uint64_t productLowHigh = aLow * bHigh;
+        uint64_t productHighLow = aHigh * bLow;
+        uint64_t productMiddle = (productLowLow >> 32) + (uint32_t) productLowHigh + (uint32_t) productHighLow;
+
+        a = (productMiddle << 32) | (uint32_t) productLowLow;
+        b = aHigh * bHigh + (productLowHigh >> 32) + (productHighLow >> 32) + (productMiddle >> 32);
+    }
+#endif
+
+    return BA_Hash_Multiply(a ^ baHashShortSecret[0] ^ length, b ^ baHashShortSecret[1]);
+}
+
+// The long input loop. Every version has to give back exactly the same accumulators as the scalar one
+
+static void BA_Hash_AccumulateScalar(uint64_t* accumulators, const unsigned char* input, const unsigned char* secret, size_t stripes) {
+    for (size_t stripe = 0; stripe < stripes; stripe++, input += BA_HASH_STRIPE_SIZE, secret += 8) {
+        for (int i = 0; i < 8; i++) {
+            uint64_t data = BA_Hash_Read64(input + i * 8);
+            uint64_t key = data ^ BA_Hash_Read64(secret + i * 8);
+
+            accumulators[i ^ 1] += data;
+            accumulators[i] += (key & 0xFFFFFFFF) * (key >> 32);
+        }
+    }
+}
+
+static void BA_Hash_ScrambleScalar(uint64_t* accumulators, const unsigned char* secret) {
+    for (int i = 0; i < 8; i++) {
+        uint64_t accumulator = accumulators[i];
+
+        accumulator ^= accumulator >> 47;
+        accumulator ^= BA_Hash_Read64(secret + i * 8);
+        accumulators[i] = accumulator * BA_HASH_PRIME32_1;
+    }
+}
+
+#if BA_HASH_SSE2
+static void BA_Hash_AccumulateSSE2(uint64_t* accumulators, const unsigned char* input, const unsigned char* secret, size_t stripes) {
+    __m128i vectors[4];
+
+    for (int i = 0; i < 4; i++)
+        vectors[i] = _mm_loadu_si128((const __m128i*) (accumulators + i * 2));
+
+    for (size_t stripe = 0; stripe < stripes; stripe++, input += BA_HASH_STRIPE_SIZE, secret += 8) {
+        for (int i = 0; i < 4; i++) {
+            __m128i data = _mm_loadu_si128((const __m128i*) (input + i * 16));
+            __m128i key = _mm_xor_si128(data, _mm_loadu_si128((const __m128i*) (secret + i * 16)));
+            __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+
+            vectors[i] = _mm_add_epi64(vectors[i], _mm_add_epi64(product, _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+    }
+
+    for (int i = 0; i < 4; i++)
+        _mm_storeu_si128((__m128i*) (accumulators + i * 2), vectors[i]);
+}
+
+static void BA_Hash_ScrambleSSE2(uint64_t* accumulators, const unsigned char* secret) {
+    __m128i prime = _mm_set1_epi32((int) BA_HASH_PRIME32_1);
+
+    for (int i = 0; i < 4; i++) {
+        __m128i accumulator = _mm_loadu_si128((const __m128i*) (accumulators + i * 2));
+
+        accumulator = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+        accumulator = _mm_xor_si128(accumulator, _mm_loadu_si128((const __m128i*) (secret + i * 16)));
+        accumulator = _mm_add_epi64(_mm_mul_epu32(accumulator, prime), _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(accumulator, 32), prime), 32));
+
+        _mm_storeu_si128((__m128i*) (accumulators + i * 2), accumulator);
+    }
+}
+#endif
+
+#if BA_HASH_AVX2
+__attribute__((target("avx2")))
+static void BA_Hash_AccumulateAVX2(uint64_t* accumulators, const unsigned char* input, const unsigned char* secret, size_t stripes) {
+    __m256i vectors[2];
+
+    for (int i = 0; i < 2; i++)
+        vectors[i] = _mm256_loadu_si256((const __m256i*) (accumulators + i * 4));
+
+    for (size_t stripe = 0; stripe < stripes; stripe++, input += BA_HASH_STRIPE_SIZE, secret += 8) {
+        for (int i = 0; i < 2; i++) {
+            __m256i data = _mm256_loadu_si256((const __m256i*) (input + i * 32));
+            __m256i key = _mm256_xor_si256(data, _mm256_loadu_si256((const __m256i*) (secret + i * 32)));
+            __m256i product = _mm256_mul_epu32(key, _mm256_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+
+            vectors[i] = _mm256_add_epi64(vectors[i], _mm256_add_epi64(product, _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+        _mm256_storeu_si256((__m256i*) (accumulators + i * 4), vectors[i]);
+}
+
+__attribute__((target("avx2")))
+static void BA_Hash_ScrambleAVX2(uint64_t* accumulators, const unsigned char* secret) {
+    __m256i prime = _mm256_set1_epi32((int) BA_HASH_PRIME32_1);
+
+    for (int i = 0; i < 2; i++) {
+        __m256i accumulator = _mm256_loadu_si256((const __m256i*) (accumulators + i * 4));
+
+        accumulator = _mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47));
+        accumulator = _mm256_xor_si256(accumulator, _mm256_loadu_si256((const __m256i*) (secret + i * 32)));
+        accumulator = _mm256_add_epi64(_mm256_mul_epu32(accumulator, prime), _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(accumulator, 32), prime), 32));
+
+        _mm256_storeu_si256((__m256i*) (accumulators + i * 4), accumulator);
+    }
+}
+#endif
+
+#if BA_HASH_NEON
+static void BA_Hash_AccumulateNEON(uint64_t* accumulators, const unsigned char* input, const unsigned char* secret, size_t stripes) {
+    uint64x2_t vectors[4];
+
+    for (int i = 0; i < 4; i++)
+        vectors[i] = vld1q_u64(accumulators + i * 2);
+
+    for (size_t stripe = 0; stripe < stripes; stripe++, input += BA_HASH_STRIPE_SIZE, secret += 8) {
+        for (int i = 0; i < 4; i++) {
+            uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(input + i * 16));
+            uint64x2_t key = veorq_u64(data, vreinterpretq_u64_u8(vld1q_u8(secret + i * 16)));
+            uint64x2_t product = vmull_u32(vmovn_u64(key), vshrn_n_u64(key, 32));
+
+            vectors[i] = vaddq_u64(vectors[i], vaddq_u64(product, vextq_u64(data, data, 1)));
+        }
+    }
+
+    for (int i = 0; i < 4; i++)
+        vst1q_u64(accumulators + i * 2, vectors[i]);
+}
+
+static void BA_Hash_ScrambleNEON(uint64_t* accumulators, const unsigned char* secret) {
+    uint32x2_t prime = vdup_n_u32(BA_HASH_PRIME32_1);
+
+    for (int i = 0; i < 4; i++) {
+        uint64x2_t accumulator = vld1q_u64(accumulators + i * 2);
+
+        accumulator = veorq_u64(accumulator, vshrq_n_u64(accumulator, 47));
+        accumulator = veorq_u64(accumulator, vreinterpretq_u64_u8(vld1q_u8(secret + i * 16)));
+        accumulator = vaddq_u64(vmull_u32(vmovn_u64(accumulator), prime), vshlq_n_u64(vmull_u32(vshrn_n_u64(accumulator, 32), prime), 32));
+
+        vst1q_u64(accumulators + i * 2, accumulator);
+    }
+}
+#endif
+
+static const BA_Hash_Implementation baHashScalar = {&BA_Hash_AccumulateScalar, &BA_Hash_ScrambleScalar, "Scalar"};
+
+#if BA_HASH_SSE2
+static const BA_Hash_Implementation baHashSSE2 = {&BA_Hash_AccumulateSSE2, &BA_Hash_ScrambleSSE2, "SSE2"};
+#endif
+
+#if BA_HASH_AVX2
+static const BA_Hash_Implementation baHashAVX2 = {&BA_Hash_AccumulateAVX2, &BA_Hash_ScrambleAVX2, "AVX2"};
+#endif
+
+#if BA_HASH_NEON
+static const BA_Hash_Implementation baHashNEON = {&BA_Hash_AccumulateNEON, &BA_Hash_ScrambleNEON, "NEON"};
+#endif
+
+static const BA_Hash_Implementation* baHashImplementation = NULL;
+
+static const BA_Hash_Implementation* BA_Hash_GetBestImplementation(void) {
+    const BA_Hash_Implementation* implementation = BA_ATOMIC_LOAD_POINTER(&baHashImplementation);
+
+    if (implementation != NULL)
+        return implementation;
+
+    implementation = &baHashScalar;
+
+#if BA_HASH_SSE2
+    implementation = &baHashSSE2;
+#endif
+
+#if BA_HASH_AVX2
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        implementation = &baHashAVX2;
+#endif
+
+#if BA_HASH_NEON
+    implementation = &baHashNEON;
+#endif
+
+    // Every thread picks the same one, so it doesn't matter who gets here first
+    BA_ATOMIC_STORE_POINTER(&baHashImplementation, (void*) implementation);
+    return implementation;
+}
+
+static void BA_Hash_ConsumeStripes(const BA_Hash_Implementation* implementation, uint64_t* accumulators, int* stripesInBlock,
+                                   const unsigned char* input, size_t stripes, const unsigned char* secret) {
+    while (stripes > 0) {
+        size_t left = (size_t) (BA_HASH_STRIPES_PER_BLOCK - *stripesInBlock);
+        size_t consuming = stripes < left ? stripes : left;
+
+        implementation->accumulate(accumulators, input, secret + *stripesInBlock * 8, consuming);
+
+        input += consuming * BA_HASH_STRIPE_SIZE;
+        stripes -= consuming;
+        *stripesInBlock += (int) consuming;
+
+        if (*stripesInBlock == BA_HASH_STRIPES_PER_BLOCK) {
+            implementation->scramble(accumulators, secret + BA_HASH_SCRAMBLE_SECRET_OFFSET);
+
+            *stripesInBlock = 0;
+        }
+    }
+}
+
+static uint64_t BA_Hash_Merge(const uint64_t* accumulators, const unsigned char* secret, uint64_t length) {
+    uint64_t result = length * BA_HASH_PRIME64_1;
+
+    for (int i = 0; i < 4; i++) {
+        const unsigned char* key = secret + BA_HASH_MERGE_SECRET_OFFSET + i * 16;
+
+        result += BA_Hash_Multiply(accumulators[i * 2] ^ BA_Hash_Read64(key), accumulators[i * 2 + 1] ^ BA_Hash_Read64(key + 8));
+    }
+
+    result ^= result >> 37;
+    result *= 0x165667919E3779F9ULL;
+    return result ^ (result >> 32);
+}
+
+static void BA_Hash_DeriveSecret(unsigned char* secret, uint64_t seed) {
+    for (size_t i = 0; i < BA_HASH_SECRET_SIZE / sizeof(uint64_t); i += 2) {
+        uint64_t low = baHashDefaultSecret[i] + seed;
+        uint64_t high = baHashDefaultSecret[i + 1] - seed;
+
+        memcpy(secret + i * 8, &low, sizeof(uint64_t));
+        memcpy(secret + i * 8 + 8, &high, sizeof(uint64_t));
+    }
+}
+
+/**
+ * Inspired by XXH3. Only stripes that have at least one byte after them go through the loop, the end is always hashed as
+ * one last, possibly overlapping, stripe. That keeps the streaming version in sync without knowing the length up front
+ */
+static uint64_t BA_Hash_Long(const unsigned char* input, size_t length, const unsigned char* secret) {
+    const BA_Hash_Implementation* implementation = BA_Hash_GetBestImplementation();
+    uint64_t accumulators[8];
+    int stripesInBlock = 0;
+
+    memcpy(accumulators, baHashInitialAccumulators, sizeof(accumulators));
+    BA_Hash_ConsumeStripes(implementation, accumulators, &stripesInBlock, input, (length - 1) / BA_HASH_STRIPE_SIZE, secret);
+    implementation->accumulate(accumulators, input + length - BA_HASH_STRIPE_SIZE, secret + BA_HASH_LAST_STRIPE_SECRET_OFFSET, 1);
+    return BA_Hash_Merge(accumulators, secret, length);
+}
+
+uint64_t BA_Hash_Bytes(const void* data, size_t length) {
+    return BA_Hash_BytesSeeded(data, length, 0);
+}
+
+uint64_t BA_Hash_BytesSeeded(const void* data, size_t length, uint64_t seed) {
+    if (length <= BA_HASH_SHORT_LIMIT)
+        return BA_Hash_Short(data, length, seed);
+
+    if (seed == 0)
+        return BA_Hash_Long(data, length, (const unsigned char*) baHashDefaultSecret);
+
+    unsigned char secret[BA_HASH_SECRET_SIZE];
+
+    BA_Hash_DeriveSecret(secret, seed);
+    return BA_Hash_Long(data, length, secret);
+}
+
+uint64_t BA_Hash_String(const char* string) {
+    return BA_Hash_Bytes(string, strlen(string));
+}
+
+uint64_t BA_Hash_WideString(const wchar_t* string) {
+    return BA_Hash_Bytes(string, wcslen(string) * sizeof(wchar_t));
+}
+
+uint64_t BA_Hash_Integer(uint64_t integer) {
+    // splitmix64's finalizer. Every input gets its own output
+    integer += 0x9E3779B97F4A7C15ULL;
+    integer = (integer ^ (integer >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    integer = (integer ^ (integer >> 27)) * 0x94D049BB133111EBULL;
+    return integer ^ (integer >> 31);
+}
+
+uint64_t BA_Hash_Combine(uint64_t hash1, uint64_t hash2) {
+    return BA_Hash_Multiply(hash1 ^ baHashShortSecret[0], hash2 ^ baHashShortSecret[1]);
+}
+
+void BA_Hash_Start(BA_Hash_State* state, uint64_t seed) {
+    memcpy(state->accumulators, baHashInitialAccumulators, sizeof(state->accumulators));
+
+    if (seed == 0)
+        memcpy(state->secret, baHashDefaultSecret, BA_HASH_SECRET_SIZE);
+    else
+        BA_Hash_DeriveSecret(state->secret, seed);
+
+    state->seed = seed;
+    state->totalLength = 0;
+    state->bufferSize = 0;
+    state->stripesInBlock = 0;
+}
+
+void BA_Hash_Update(BA_Hash_State* state, const void* data, size_t length) {
+    const unsigned char* input = data;
+
+    state->totalLength += length;
+
+    if (state->bufferSize + length <= BA_HASH_BUFFER_SIZE) {
+        memcpy(state->buffer + state->bufferSize, input, length);
+
+        state->bufferSize += length;
+        return;
+    }
+
+    const BA_Hash_Implementation* implementation = BA_Hash_GetBestImplementation();
+    size_t filling = BA_HASH_BUFFER_SIZE - state->bufferSize;
+    const unsigned char* consumedEnd = state->buffer + BA_HASH_BUFFER_SIZE;
+
+    memcpy(state->buffer + state->bufferSize, input, filling);
+
+    input += filling;
+    length -= filling;
+
+    // There's more input after the buffer, so every stripe in it is safe to consume
+    BA_Hash_ConsumeStripes(implementation, state->accumulators, &state->stripesInBlock, state->buffer, BA_HASH_BUFFER_SIZE / BA_HASH_STRIPE_SIZE, state->secret);
+
+    while (length > BA_HASH_BUFFER_SIZE) {
+        BA_Hash_ConsumeStripes(implementation, state->accumulators, &state->stripesInBlock, input, BA_HASH_BUFFER_SIZE / BA_HASH_STRIPE_SIZE, state->secret);
+
+        input += BA_HASH_BUFFER_SIZE;
+        length -= BA_HASH_BUFFER_SIZE;
+        consumedEnd = input;
+    }
+
+    // The last stripe might need some of this, if the input ends with less than a stripe in the buffer
+    memcpy(state->lastStripe, consumedEnd - BA_HASH_STRIPE_SIZE, BA_HASH_STRIPE_SIZE);
+    memcpy(state->buffer, input, length);
+
+    state->bufferSize = length;
+}
+
+uint64_t BA_Hash_Finish(const BA_Hash_State* state) {
+    if (state->totalLength <= BA_HASH_SHORT_LIMIT)
+        return BA_Hash_Short(state->buffer, state->bufferSize, state->seed);
+
+    const BA_Hash_Implementation* implementation = BA_Hash_GetBestImplementation();
+    uint64_t accumulators[8];
+    int stripesInBlock = state->stripesInBlock;
+    unsigned char lastStripe[BA_HASH_STRIPE_SIZE];
+    const unsigned char* last = lastStripe;
+
+    memcpy(accumulators, state->accumulators, sizeof(accumulators));
+
+    if (state->bufferSize >= BA_HASH_STRIPE_SIZE) {
+        BA_Hash_ConsumeStripes(implementation, accumulators, &stripesInBlock, state->buffer, (state->bufferSize - 1) / BA_HASH_STRIPE_SIZE, state->secret);
+
+        last = state->buffer + state->bufferSize - BA_HASH_STRIPE_SIZE;
+    } else {
+        size_t fromPrevious = BA_HASH_STRIPE_SIZE - state->bufferSize;
+
+        memcpy(lastStripe, state->lastStripe + state->bufferSize, fromPrevious);
+        memcpy(lastStripe + fromPrevious, state->buffer, state->bufferSize);
+    }
+
+    implementation->accumulate(accumulators, last, state->secret + BA_HASH_LAST_STRIPE_SECRET_OFFSET, 1);
+    return BA_Hash_Merge(accumulators, state->secret, state->totalLength);
+}
+
+const char* BA_Hash_GetImplementation(void) {
+    return BA_Hash_GetBestImplementation()->name;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,184 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BaconAPI/LineReader.h"
+#include "BaconAPI/Internal/Boolean.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+struct BA_LineReader {
+    FILE* file;
+    BA_FileStream* stream; // Reads from this instead of file, if it isn't NULL
+    const char* chunk; // What's left of the stream's current chunk
+    size_t chunkLeft;
+    char* buffer;
+    size_t capacity; // Doesn't count the extra byte for the null terminator
+    size_t start; // Where the next line starts
+    size_t end; // Where the read data ends
+    size_t searched; // Everything before this is already known to not have the delimiter
+    BA_Boolean endOfFile;
+    size_t delimiterLength;
+    char delimiter[];
+};
+
+static char* BA_LineReader_Find(BA_LineReader* reader) {
+    char* position = reader->buffer + reader->searched;
+    char* end = reader->buffer + reader->end;
+    size_t delimiterLength = reader->delimiterLength;
+
+    // memchr is vectorized in pretty much every C library, so let it find the first byte
+    while ((size_t) (end - position) >= delimiterLength) {
+        position = memchr(position, reader->delimiter[0], (size_t) (end - position) - delimiterLength + 1);
+
+        if (position == NULL)
+            break;
+
+        if (memcmp(position + 1, reader->delimiter + 1, delimiterLength - 1) == 0)
+            return position;
+
+        position++;
+    }
+
+    // The delimiter might start in the last few bytes, and finish in the next block
+    reader->searched = reader->end - reader->start >= delimiterLength - 1 ? reader->end - (delimiterLength - 1) : reader->start;
+    return NULL;
+}
+
+static BA_Boolean BA_LineReader_FillFromStream(BA_LineReader* reader) {
+    while (reader->end < reader->capacity) {
+        if (reader->chunkLeft == 0) {
+            intmax_t length = BA_FileStream_Next(reader->stream, &reader->chunk);
+
+            if (length < 0) {
+                reader->endOfFile = BA_BOOLEAN_TRUE;
+                return length != -2;
+            }
+
+            reader->chunkLeft = (size_t) length;
+        }
+
+        size_t amount = reader->capacity - reader->end < reader->chunkLeft ? reader->capacity - reader->end : reader->chunkLeft;
+
+        memcpy(reader->buffer + reader->end, reader->chunk, amount);
+
+        reader->end += amount;
+        reader->chunk += amount;
+        reader->chunkLeft -= amount;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+static BA_Boolean BA_LineReader_Fill(BA_LineReader* reader) {
+    // Only the unfinished line is left, so move it to the front to make room
+    if (reader->start > 0) {
+        memmove(reader->buffer, reader->buffer + reader->start, reader->end - reader->start);
+
+        reader->end -= reader->start;
+        reader->searched -= reader->start;
+        reader->start = 0;
+    }
+
+    if (reader->end == reader->capacity) {
+        char* newBuffer = realloc(reader->buffer, reader->capacity * 2 + 1);
+
+        if (newBuffer == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        reader->buffer = newBuffer;
+        reader->capacity *= 2;
+    }
+
+    if (reader->stream != NULL)
+        return BA_LineReader_FillFromStream(reader);
+
+    size_t wanted = reader->capacity - reader->end;
+    size_t amount = fread(reader->buffer + reader->end, sizeof(char), wanted, reader->file);
+
+    reader->end += amount;
+    reader->endOfFile = amount < wanted;
+    return !ferror(reader->file);
+}
+
+BA_LineReader* BA_LineReader_Create(FILE* file, const char* delimiter, size_t blockSize) {
+    const char* currentDelimiter = delimiter != NULL && delimiter[0] != '\0' ? delimiter : "\n";
+    size_t delimiterLength = strlen(currentDelimiter);
+    BA_LineReader* reader = malloc(sizeof(BA_LineReader) + delimiterLength + 1);
+
+    if (reader == NULL)
+        return NULL;
+
+    reader->capacity = blockSize != 0 ? blockSize : BA_LINEREADER_DEFAULT_BLOCK_SIZE;
+    reader->buffer = malloc(reader->capacity + 1);
+
+    if (reader->buffer == NULL) {
+        free(reader);
+        return NULL;
+    }
+
+    reader->file = file;
+    reader->stream = NULL;
+    reader->chunk = NULL;
+    reader->chunkLeft = 0;
+    reader->start = 0;
+    reader->end = 0;
+    reader->searched = 0;
+    reader->endOfFile = BA_BOOLEAN_FALSE;
+    reader->delimiterLength = delimiterLength;
+
+    memcpy(reader->delimiter, currentDelimiter, delimiterLength + 1);
+    return reader;
+}
+
+BA_LineReader* BA_LineReader_CreateFromStream(BA_FileStream* stream, const char* delimiter) {
+    BA_LineReader* reader = BA_LineReader_Create(NULL, delimiter, 0);
+
+    if (reader != NULL)
+        reader->stream = stream;
+
+    return reader;
+}
+
+void BA_LineReader_Free(BA_LineReader* reader) {
+    if (reader == NULL)
+        return;
+
+    free(reader->buffer);
+    free(reader);
+}
+
+intmax_t BA_LineReader_Next(BA_LineReader* reader, char** line) {
+    while (BA_BOOLEAN_TRUE) {
+        char* lineStart = reader->buffer + reader->start;
+        char* found = BA_LineReader_Find(reader);
+        size_t length;
+
+        if (found != NULL) {
+            length = (size_t) (found - lineStart);
+            reader->start += length + reader->delimiterLength;
+        } else if (reader->endOfFile) {
+            if (reader->start == reader->end)
+                return -1;
+
+            length = reader->end - reader->start;
+            found = reader->buffer + reader->end;
+            reader->start = reader->end;
+        } else {
+            if (!BA_LineReader_Fill(reader))
+                return -2;
+
+            continue;
+        }
+
+        *found = '\0';
+        reader->searched = reader->start;
+
+        if (line != NULL)
+            *line = lineStart;
+
+        return (intmax_t) length;
+    }
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
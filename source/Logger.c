@@ -192,7 +192,20 @@ void BA_Logger_LogHeader(FILE* output, BA_Logger_LogLevels logLevel) {
             return;
     }
 
-#   define BA_LOGGER_SAFE_PUTS(message) write(fileno(output), message, strlen(message))
+    // Built up first, so it goes out in one write
+    char header[64];
+    size_t headerLength = 0;
+
+#   define BA_LOGGER_SAFE_PUTS(message) do { \
+        const char* piece = (message);        \
+        size_t pieceLength = strlen(piece);   \
+                                              \
+        if (headerLength + pieceLength <= sizeof(header)) { \
+            memcpy(header + headerLength, piece, pieceLength); \
+            headerLength += pieceLength;      \
+        }                                     \
+    } while (BA_BOOLEAN_FALSE)
+
     switch (logLevel) {
 #   ifdef BA_ALLOW_DEBUG_LOGS
         case BA_LOGGER_LOG_LEVEL_TRACE:
@@ -247,6 +260,8 @@ void BA_Logger_LogHeader(FILE* output, BA_Logger_LogLevels logLevel) {
 
     if (BA_ANSI_IsEnabled())
         BA_LOGGER_SAFE_PUTS(BA_ANSI_ConvertCodeToString(BA_ANSI_CODE_RESET));
+
+    fwrite(header, sizeof(char), headerLength, output);
 #   undef BA_LOGGER_SAFE_PUTS
 #endif
 }
@@ -0,0 +1,249 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include "BaconAPI/OperatingSystem.h"
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+#   define _DEFAULT_SOURCE
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#elif BA_OPERATINGSYSTEM_WINDOWS
+#   include <Windows.h>
+#   include <io.h>
+#endif
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "BaconAPI/MappedFile.h"
+
+#define BA_MAPPEDFILE_HUGE_PAGE_SIZE ((size_t) 2 * 1024 * 1024)
+#define BA_MAPPEDFILE_READ_BLOCK_SIZE 65536
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+struct BA_MappedFile {
+    char* data;
+    size_t length;
+    BA_Boolean mapped;
+#if BA_OPERATINGSYSTEM_WINDOWS
+    HANDLE mapping;
+#endif
+};
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+static void* BA_MappedFile_MapAligned(int descriptor, size_t length) {
+#if BA_OPERATINGSYSTEM_LINUX && defined(MADV_HUGEPAGE)
+    // Huge pages only work if the mapping starts on a huge page boundary. Reserve a bit extra, so we can line it up
+    if (length < BA_MAPPEDFILE_HUGE_PAGE_SIZE)
+        return NULL;
+
+    size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+    size_t reservedLength = length + BA_MAPPEDFILE_HUGE_PAGE_SIZE;
+    char* reserved = mmap(NULL, reservedLength, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (reserved == MAP_FAILED)
+        return NULL;
+
+    char* aligned = (char*) (((uintptr_t) reserved + BA_MAPPEDFILE_HUGE_PAGE_SIZE - 1) & ~(uintptr_t) (BA_MAPPEDFILE_HUGE_PAGE_SIZE - 1));
+    char* mappedEnd = aligned + (length + pageSize - 1) / pageSize * pageSize;
+    char* reservedEnd = reserved + reservedLength;
+
+    if (mmap(aligned, length, PROT_READ, MAP_PRIVATE | MAP_FIXED, descriptor, 0) == MAP_FAILED) {
+        munmap(reserved, reservedLength);
+        return NULL;
+    }
+
+    // Give back the parts we didn't use
+    if (aligned > reserved)
+        munmap(reserved, (size_t) (aligned - reserved));
+
+    if (reservedEnd > mappedEnd)
+        munmap(mappedEnd, (size_t) (reservedEnd - mappedEnd));
+
+    // Only a hint, not every file system supports it
+    madvise(aligned, length, MADV_HUGEPAGE);
+    return aligned;
+#else
+    (void) descriptor;
+    (void) length;
+    return NULL;
+#endif
+}
+#endif
+
+static BA_Boolean BA_MappedFile_Map(BA_MappedFile* mappedFile, FILE* file, BA_MappedFile_Access access) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    int descriptor = fileno(file);
+    struct stat information;
+
+    // Empty files are read instead, since some special files say they're empty even though they aren't
+    if (descriptor == -1 || fstat(descriptor, &information) != 0 || !S_ISREG(information.st_mode) || information.st_size <= 0 ||
+        (uintmax_t) information.st_size > SIZE_MAX)
+        return BA_BOOLEAN_FALSE;
+
+    size_t length = (size_t) information.st_size;
+    void* data = BA_MappedFile_MapAligned(descriptor, length);
+
+    if (data == NULL) {
+        data = mmap(NULL, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (data == MAP_FAILED)
+            return BA_BOOLEAN_FALSE;
+    }
+
+    switch (access) {
+        case BA_MAPPEDFILE_ACCESS_SEQUENTIAL:
+            madvise(data, length, MADV_SEQUENTIAL);
+            madvise(data, length, MADV_WILLNEED);
+            break;
+
+        case BA_MAPPEDFILE_ACCESS_RANDOM:
+            madvise(data, length, MADV_RANDOM);
+            break;
+
+        default:
+            break;
+    }
+
+    mappedFile->data = data;
+    mappedFile->length = length;
+    return BA_BOOLEAN_TRUE;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    HANDLE handle = (HANDLE) _get_osfhandle(_fileno(file));
+    LARGE_INTEGER size;
+
+    (void) access;
+
+    if (handle == INVALID_HANDLE_VALUE || GetFileType(handle) != FILE_TYPE_DISK || !GetFileSizeEx(handle, &size) ||
+        size.QuadPart <= 0 || (unsigned long long) size.QuadPart > SIZE_MAX)
+        return BA_BOOLEAN_FALSE;
+
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (mapping == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return BA_BOOLEAN_FALSE;
+    }
+
+    mappedFile->data = data;
+    mappedFile->length = (size_t) size.QuadPart;
+    mappedFile->mapping = mapping;
+    return BA_BOOLEAN_TRUE;
+#else
+    (void) mappedFile;
+    (void) file;
+    (void) access;
+    return BA_BOOLEAN_FALSE;
+#endif
+}
+
+static BA_Boolean BA_MappedFile_Read(BA_MappedFile* mappedFile, FILE* file) {
+    size_t capacity = BA_MAPPEDFILE_READ_BLOCK_SIZE;
+    size_t length = 0;
+    char* buffer = malloc(capacity + 1);
+    size_t amount;
+
+    if (buffer == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    do {
+        if (length == capacity) {
+            char* newBuffer = realloc(buffer, capacity * 2 + 1);
+
+            if (newBuffer == NULL) {
+                free(buffer);
+                return BA_BOOLEAN_FALSE;
+            }
+
+            buffer = newBuffer;
+            capacity *= 2;
+        }
+
+        amount = fread(buffer + length, sizeof(char), capacity - length, file);
+        length += amount;
+    } while (amount != 0);
+
+    if (ferror(file)) {
+        free(buffer);
+        return BA_BOOLEAN_FALSE;
+    }
+
+    // Don't hold on to up to twice what we need
+    if (length < capacity) {
+        char* newBuffer = realloc(buffer, length + 1);
+
+        if (newBuffer != NULL)
+            buffer = newBuffer;
+    }
+
+    buffer[length] = '\0';
+    mappedFile->data = buffer;
+    mappedFile->length = length;
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_MappedFile* BA_MappedFile_Open(const char* path, BA_MappedFile_Access access) {
+    FILE* file = fopen(path, "rb");
+
+    if (file == NULL)
+        return NULL;
+
+    BA_MappedFile* mappedFile = BA_MappedFile_OpenFile(file, access);
+
+    fclose(file);
+    return mappedFile;
+}
+
+BA_MappedFile* BA_MappedFile_OpenFile(FILE* file, BA_MappedFile_Access access) {
+    BA_MappedFile* mappedFile = malloc(sizeof(BA_MappedFile));
+
+    if (mappedFile == NULL)
+        return NULL;
+
+    mappedFile->mapped = BA_MappedFile_Map(mappedFile, file, access);
+
+    if (!mappedFile->mapped && !BA_MappedFile_Read(mappedFile, file)) {
+        free(mappedFile);
+        return NULL;
+    }
+
+    return mappedFile;
+}
+
+void BA_MappedFile_Close(BA_MappedFile* mappedFile) {
+    if (mappedFile == NULL)
+        return;
+
+    if (!mappedFile->mapped)
+        free(mappedFile->data);
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    else
+        munmap(mappedFile->data, mappedFile->length);
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    else {
+        UnmapViewOfFile(mappedFile->data);
+        CloseHandle(mappedFile->mapping);
+    }
+#endif
+
+    free(mappedFile);
+}
+
+const char* BA_MappedFile_GetData(const BA_MappedFile* mappedFile) {
+    return mappedFile->data;
+}
+
+size_t BA_MappedFile_GetLength(const BA_MappedFile* mappedFile) {
+    return mappedFile->length;
+}
+
+BA_Boolean BA_MappedFile_IsMapped(const BA_MappedFile* mappedFile) {
+    return mappedFile->mapped;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -2,9 +2,16 @@
 // Licensed under MIT <https://opensource.org/licenses/MIT>
 
 #include <stdlib.h>
+#include <string.h>
 #include <BaconAPI/Logger.h>
 
 #include "BaconAPI/Number.h"
+#include "BaconAPI/Internal/Compiler.h"
+#include "NumberTables.h"
+
+#if BA_COMPILER_MSVC
+#   include <intrin.h>
+#endif
 
 #define BA_NUMBER_STRING_CONVERT_IMPLEMENTATION(type, parsedType, to, min, max, function) \
 BA_NUMBER_STRING_CONVERT(type, to) {                                                      \
@@ -31,4 +38,373 @@ BA_NUMBER_STRING_CONVERT_IMPLEMENTATION(int64_t, int64_t, Long, LONG_MIN, LONG_M
 BA_NUMBER_STRING_CONVERT_IMPLEMENTATION(uint64_t, uint64_t, UnsignedLong, 0, ULONG_MAX, strtoul)
 BA_NUMBER_STRING_CONVERT_IMPLEMENTATION(intmax_t, intmax_t, LongLong, LLONG_MIN, LLONG_MAX, strtoll)
 BA_NUMBER_STRING_CONVERT_IMPLEMENTATION(uintmax_t, uintmax_t, UnsignedLongLong, 0, ULLONG_MAX, strtoull)
+
+// Index zero is zero on purpose, so that zero still counts as one digit
+static const uint64_t baNumberPowersOfTen[20] = {
+    0u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u, 10000000000u,
+    100000000000u, 1000000000000u, 10000000000000u, 100000000000000u, 1000000000000000u, 10000000000000000u,
+    100000000000000000u, 1000000000000000000u, 10000000000000000000u
+};
+
+static const char baNumberDigitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static int BA_Number_GetBitLength(uint64_t number) {
+#if BA_COMPILER_GCC || BA_COMPILER_CLANG
+    return 64 - __builtin_clzll(number | 1);
+#elif BA_COMPILER_MSVC && defined(_M_X64)
+    unsigned long index;
+
+    _BitScanReverse64(&index, number | 1);
+    return (int) index + 1;
+#else
+    int length = 1;
+
+    while ((number >>= 1) != 0)
+        length++;
+
+    return length;
+#endif
+}
+
+int BA_Number_GetDigitCount(uint64_t number) {
+    // 1233 / 4096 is close enough to log10(2) for every 64-bit number
+    int digits = (BA_Number_GetBitLength(number) * 1233) >> 12;
+
+    return digits + 1 - (number < baNumberPowersOfTen[digits]);
+}
+
+static void BA_Number_WriteDigits(uint64_t number, char* end) {
+    while (number >= 100) {
+        unsigned pair = (unsigned) (number % 100) * 2;
+
+        number /= 100;
+        end -= 2;
+
+        memcpy(end, baNumberDigitPairs + pair, 2);
+    }
+
+    if (number >= 10) {
+        memcpy(end - 2, baNumberDigitPairs + number * 2, 2);
+        return;
+    }
+
+    end[-1] = (char) ('0' + number);
+}
+
+size_t BA_Number_UnsignedLongToString(uint64_t number, char* buffer) {
+    int length = BA_Number_GetDigitCount(number);
+
+    BA_Number_WriteDigits(number, buffer + length);
+
+    buffer[length] = '\0';
+    return length;
+}
+
+size_t BA_Number_LongToString(int64_t number, char* buffer) {
+    if (number >= 0)
+        return BA_Number_UnsignedLongToString((uint64_t) number, buffer);
+
+    buffer[0] = '-';
+    return BA_Number_UnsignedLongToString(0 - (uint64_t) number, buffer + 1) + 1;
+}
+
+// Everything below is Ryu (https://github.com/ulfjack/ryu), which finds the shortest decimal that rounds back to the
+// same double
+
+#define BA_NUMBER_DOUBLE_MANTISSA_BITS 52
+#define BA_NUMBER_DOUBLE_EXPONENT_BITS 11
+#define BA_NUMBER_DOUBLE_BIAS 1023
+
+static int32_t BA_Number_Pow5Bits(int32_t exponent) {
+    return (int32_t) (((uint32_t) exponent * 1217359) >> 19) + 1;
+}
+
+static uint32_t BA_Number_Log10Pow2(int32_t exponent) {
+    return ((uint32_t) exponent * 78913) >> 18;
+}
+
+static uint32_t BA_Number_Log10Pow5(int32_t exponent) {
+    return ((uint32_t) exponent * 732923) >> 20;
+}
+
+static BA_Boolean BA_Number_IsMultipleOfPowerOf5(uint64_t value, uint32_t power) {
+    uint32_t count = 0;
+
+    while (value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+
+    return count >= power;
+}
+
+static BA_Boolean BA_Number_IsMultipleOfPowerOf2(uint64_t value, uint32_t power) {
+    return (value & ((1ull << power) - 1)) == 0;
+}
+
+static uint64_t BA_Number_MultiplyShift(uint64_t mantissa, const uint64_t* multiplier, int32_t shift) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 low = (unsigned __int128) mantissa * multiplier[0];
+    unsigned __int128 high = (unsigned __int128) mantissa * multiplier[1];
+
+    return (uint64_t) (((low >> 64) + high) >> (shift - 64));
+#else
+#   define BA_NUMBER_MULTIPLY_128(a, b, resultLow, resultHigh) \
+do {                                                           \
+    uint64_t aLow = (uint32_t) (a);                            \
+    uint64_t aHigh = (a) >> 32;                                \
+    uint64_t bLow = (uint32_t) (b);                            \
+    uint64_t bHigh = (b) >> 32;                                \
+    uint64_t productLowLow = aLow * bLow;                      \
+    uint64_t productLowHigh = aLow * bHigh;                    \
+    uint64_t productHighLow = aHigh * bLow;                    \
+    uint64_t productMiddle = (productLowLow >> 32) + (uint32_t) productLowHigh + (uint32_t) productHighLow; \
+    resultLow = (productMiddle << 32) | (uint32_t) productLowLow; \
+    resultHigh = aHigh * bHigh + (productLowHigh >> 32) + (productHighLow >> 32) + (productMiddle >> 32); \
+} while (BA_BOOLEAN_FALSE)
+
+    uint64_t lowLow;
+    uint64_t lowHigh;
+    uint64_t highLow;
+    uint64_t highHigh;
+
+    BA_NUMBER_MULTIPLY_128(mantissa, multiplier[0], lowLow, lowHigh);
+    BA_NUMBER_MULTIPLY_128(mantissa, multiplier[1], highLow, highHigh);
+    (void) lowLow;
+
+    uint64_t sumLow = lowHigh + highLow;
+    uint64_t sumHigh = highHigh + (sumLow < lowHigh);
+
+    shift -= 64;
+    return shift == 0 ? sumLow : (sumHigh << (64 - shift)) | (sumLow >> shift);
+#   undef BA_NUMBER_MULTIPLY_128
+#endif
+}
+
+static void BA_Number_ShortestDecimal(uint64_t ieeeMantissa, uint32_t ieeeExponent, uint64_t* outputDigits, int32_t* outputExponent) {
+    int32_t exponent2;
+    uint64_t mantissa2;
+
+    if (ieeeExponent == 0) {
+        exponent2 = 1 - BA_NUMBER_DOUBLE_BIAS - BA_NUMBER_DOUBLE_MANTISSA_BITS - 2;
+        mantissa2 = ieeeMantissa;
+    } else {
+        exponent2 = (int32_t) ieeeExponent - BA_NUMBER_DOUBLE_BIAS - BA_NUMBER_DOUBLE_MANTISSA_BITS - 2;
+        mantissa2 = (1ull << BA_NUMBER_DOUBLE_MANTISSA_BITS) | ieeeMantissa;
+    }
+
+    BA_Boolean acceptBounds = (mantissa2 & 1) == 0;
+    uint64_t mantissaVector = 4 * mantissa2;
+    uint32_t mantissaShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+    uint64_t vr;
+    uint64_t vp;
+    uint64_t vm;
+    int32_t exponent10;
+    BA_Boolean vmIsTrailingZeros = BA_BOOLEAN_FALSE;
+    BA_Boolean vrIsTrailingZeros = BA_BOOLEAN_FALSE;
+
+    if (exponent2 >= 0) {
+        uint32_t q = BA_Number_Log10Pow2(exponent2) - (exponent2 > 3);
+        int32_t k = BA_NUMBER_POW5_INVERSE_BIT_COUNT + BA_Number_Pow5Bits((int32_t) q) - 1;
+        int32_t i = -exponent2 + (int32_t) q + k;
+
+        exponent10 = (int32_t) q;
+        vr = BA_Number_MultiplyShift(4 * mantissa2, baNumberPow5InverseSplit[q], i);
+        vp = BA_Number_MultiplyShift(4 * mantissa2 + 2, baNumberPow5InverseSplit[q], i);
+        vm = BA_Number_MultiplyShift(4 * mantissa2 - 1 - mantissaShift, baNumberPow5InverseSplit[q], i);
+
+        if (q <= 21) {
+            if (mantissaVector % 5 == 0)
+                vrIsTrailingZeros = BA_Number_IsMultipleOfPowerOf5(mantissaVector, q);
+            else if (acceptBounds)
+                vmIsTrailingZeros = BA_Number_IsMultipleOfPowerOf5(mantissaVector - 1 - mantissaShift, q);
+            else
+                vp -= BA_Number_IsMultipleOfPowerOf5(mantissaVector + 2, q);
+        }
+    } else {
+        uint32_t q = BA_Number_Log10Pow5(-exponent2) - (-exponent2 > 1);
+        int32_t i = -exponent2 - (int32_t) q;
+        int32_t k = BA_Number_Pow5Bits(i) - BA_NUMBER_POW5_BIT_COUNT;
+        int32_t j = (int32_t) q - k;
+
+        exponent10 = (int32_t) q + exponent2;
+        vr = BA_Number_MultiplyShift(4 * mantissa2, baNumberPow5Split[i], j);
+        vp = BA_Number_MultiplyShift(4 * mantissa2 + 2, baNumberPow5Split[i], j);
+        vm = BA_Number_MultiplyShift(4 * mantissa2 - 1 - mantissaShift, baNumberPow5Split[i], j);
+
+        if (q <= 1) {
+            vrIsTrailingZeros = BA_BOOLEAN_TRUE;
+
+            if (acceptBounds)
+                vmIsTrailingZeros = mantissaShift == 1;
+            else
+                vp--;
+        } else if (q < 63)
+            vrIsTrailingZeros = BA_Number_IsMultipleOfPowerOf2(mantissaVector, q);
+    }
+
+    int32_t removed = 0;
+    uint8_t lastRemovedDigit = 0;
+    uint64_t output;
+
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        // Rare path, has to keep track of trailing zeros to round correctly
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (uint8_t) (vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (uint8_t) (vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+
+        // Round to even if the exact number ends in 50...0
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+            lastRemovedDigit = 4;
+
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    } else {
+        BA_Boolean roundUp = BA_BOOLEAN_FALSE;
+
+        if (vp / 100 > vm / 100) {
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+
+        while (vp / 10 > vm / 10) {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        output = vr + (vr == vm || roundUp);
+    }
+
+    *outputDigits = output;
+    *outputExponent = exponent10 + removed;
+}
+
+size_t BA_Number_DoubleToString(double number, char* buffer) {
+    uint64_t bits;
+
+    memcpy(&bits, &number, sizeof(double));
+
+    BA_Boolean negative = (bits >> 63) != 0;
+    uint64_t ieeeMantissa = bits & ((1ull << BA_NUMBER_DOUBLE_MANTISSA_BITS) - 1);
+    uint32_t ieeeExponent = (uint32_t) ((bits >> BA_NUMBER_DOUBLE_MANTISSA_BITS) & ((1u << BA_NUMBER_DOUBLE_EXPONENT_BITS) - 1));
+    char* cursor = buffer;
+
+    if (ieeeExponent == (1u << BA_NUMBER_DOUBLE_EXPONENT_BITS) - 1) {
+        if (ieeeMantissa != 0) {
+            memcpy(buffer, "nan", 4);
+            return 3;
+        }
+
+        if (negative)
+            *cursor++ = '-';
+
+        memcpy(cursor, "inf", 4);
+        return cursor - buffer + 3;
+    }
+
+    if (negative)
+        *cursor++ = '-';
+
+    if (ieeeExponent == 0 && ieeeMantissa == 0) {
+        memcpy(cursor, "0.0", 4);
+        return cursor - buffer + 3;
+    }
+
+    uint64_t digits;
+    int32_t exponent;
+
+    BA_Number_ShortestDecimal(ieeeMantissa, ieeeExponent, &digits, &exponent);
+
+    char digitString[BA_NUMBER_INTEGER_BUFFER_SIZE];
+    int length = (int) BA_Number_UnsignedLongToString(digits, digitString);
+    int scientificExponent = exponent + length - 1;
+
+    if (scientificExponent < -4 || scientificExponent > 15) {
+        *cursor++ = digitString[0];
+
+        if (length > 1) {
+            *cursor++ = '.';
+
+            memcpy(cursor, digitString + 1, length - 1);
+
+            cursor += length - 1;
+        }
+
+        *cursor++ = 'e';
+        *cursor++ = scientificExponent < 0 ? '-' : '+';
+
+        if (scientificExponent < 0)
+            scientificExponent = -scientificExponent;
+
+        if (scientificExponent < 10)
+            *cursor++ = '0';
+
+        cursor += BA_Number_UnsignedLongToString((uint64_t) scientificExponent, cursor);
+        return cursor - buffer;
+    }
+
+    if (scientificExponent < 0) {
+        memcpy(cursor, "0.", 2);
+        memset(cursor + 2, '0', -scientificExponent - 1);
+
+        cursor += 1 - scientificExponent;
+
+        memcpy(cursor, digitString, length);
+
+        cursor += length;
+    } else if (scientificExponent >= length - 1) {
+        memcpy(cursor, digitString, length);
+        memset(cursor + length, '0', scientificExponent - length + 1);
+
+        cursor += scientificExponent + 1;
+
+        memcpy(cursor, ".0", 2);
+
+        cursor += 2;
+    } else {
+        memcpy(cursor, digitString, scientificExponent + 1);
+
+        cursor += scientificExponent + 1;
+        *cursor++ = '.';
+
+        memcpy(cursor, digitString + scientificExponent + 1, length - scientificExponent - 1);
+
+        cursor += length - scientificExponent - 1;
+    }
+
+    *cursor = '\0';
+    return cursor - buffer;
+}
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
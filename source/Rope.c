@@ -0,0 +1,609 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BaconAPI/Rope.h"
+#include "BaconAPI/Debugging/Assert.h"
+
+#define BA_ROPE_CHUNK_SIZE 1024
+#define BA_ROPE_MAX_CHILDREN 16
+#define BA_ROPE_MAX_SPARE_NODES 24
+
+// Big inserts get split into pieces this size, so a leaf never has to hold more than one and a half chunks
+#define BA_ROPE_INSERT_PIECE_SIZE (BA_ROPE_CHUNK_SIZE / 2)
+
+// Anything smaller than this gets merged with, or borrows from, a sibling
+#define BA_ROPE_MINIMUM_CHUNK_SIZE (BA_ROPE_CHUNK_SIZE / 4)
+#define BA_ROPE_MINIMUM_CHILDREN (BA_ROPE_MAX_CHILDREN / 4)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef struct BA_Rope_Node {
+    size_t length;
+    size_t newlines;
+    int amount;
+    BA_Boolean leaf;
+    union {
+        struct BA_Rope_Node* children[BA_ROPE_MAX_CHILDREN + 1]; // One extra, so we can insert before splitting
+        char text[BA_ROPE_CHUNK_SIZE];
+    };
+} BA_Rope_Node;
+
+struct BA_Rope {
+    BA_Rope_Node* root;
+    int height;
+
+    // Splitting takes nodes from here, so an insert can't run out of memory halfway through changing the tree
+    BA_Rope_Node* spareNodes[BA_ROPE_MAX_SPARE_NODES];
+    int spareAmount;
+};
+
+static size_t BA_Rope_CountNewlines(const char* text, size_t length) {
+    const char* end = text + length;
+    size_t newlines = 0;
+
+    while ((text = memchr(text, '\n', end - text)) != NULL) {
+        newlines++;
+        text++;
+    }
+
+    return newlines;
+}
+
+static BA_Boolean BA_Rope_Reserve(BA_Rope* rope, int amount) {
+    BA_ASSERT(amount <= BA_ROPE_MAX_SPARE_NODES, "Rope is too tall\n");
+
+    while (rope->spareAmount < amount) {
+        BA_Rope_Node* node = malloc(sizeof(BA_Rope_Node));
+
+        if (node == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        rope->spareNodes[rope->spareAmount++] = node;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+static BA_Rope_Node* BA_Rope_TakeNode(BA_Rope* rope, BA_Boolean leaf) {
+    BA_ASSERT(rope->spareAmount > 0, "Rope ran out of reserved nodes\n");
+
+    BA_Rope_Node* node = rope->spareNodes[--rope->spareAmount];
+
+    node->length = 0;
+    node->newlines = 0;
+    node->amount = 0;
+    node->leaf = leaf;
+    return node;
+}
+
+static void BA_Rope_GiveNode(BA_Rope* rope, BA_Rope_Node* node) {
+    if (rope->spareAmount < BA_ROPE_MAX_SPARE_NODES) {
+        rope->spareNodes[rope->spareAmount++] = node;
+        return;
+    }
+
+    free(node);
+}
+
+static void BA_Rope_FreeNode(BA_Rope* rope, BA_Rope_Node* node) {
+    if (!node->leaf) {
+        for (int i = 0; i < node->amount; i++)
+            BA_Rope_FreeNode(rope, node->children[i]);
+    }
+
+    BA_Rope_GiveNode(rope, node);
+}
+
+static void BA_Rope_Recalculate(BA_Rope_Node* node) {
+    node->length = 0;
+    node->newlines = 0;
+
+    for (int i = 0; i < node->amount; i++) {
+        node->length += node->children[i]->length;
+        node->newlines += node->children[i]->newlines;
+    }
+}
+
+static void BA_Rope_RemoveChild(BA_Rope_Node* node, int index) {
+    memmove(&node->children[index], &node->children[index + 1], (node->amount - index - 1) * sizeof(BA_Rope_Node*));
+    node->amount--;
+}
+
+/**
+ * @return The new right sibling if node had to be split, NULL otherwise
+ * @note length can't be bigger than BA_ROPE_INSERT_PIECE_SIZE
+ */
+static BA_Rope_Node* BA_Rope_InsertNode(BA_Rope* rope, BA_Rope_Node* node, size_t position, const char* string, size_t length, size_t newlines) {
+    if (node->leaf) {
+        if (node->length + length <= BA_ROPE_CHUNK_SIZE) {
+            memmove(node->text + position + length, node->text + position, node->length - position);
+            memcpy(node->text + position, string, length);
+
+            node->length += length;
+            node->newlines += newlines;
+            return NULL;
+        }
+
+        char combined[BA_ROPE_CHUNK_SIZE + BA_ROPE_INSERT_PIECE_SIZE];
+        size_t total = node->length + length;
+        size_t half = total / 2;
+        BA_Rope_Node* right = BA_Rope_TakeNode(rope, BA_BOOLEAN_TRUE);
+
+        memcpy(combined, node->text, position);
+        memcpy(combined + position, string, length);
+        memcpy(combined + position + length, node->text + position, node->length - position);
+        memcpy(node->text, combined, half);
+        memcpy(right->text, combined + half, total - half);
+
+        node->length = half;
+        node->newlines = BA_Rope_CountNewlines(node->text, half);
+        right->length = total - half;
+        right->newlines = BA_Rope_CountNewlines(right->text, total - half);
+        return right;
+    }
+
+    int index = 0;
+
+    // Positions right between two children go to the left one
+    while (index < node->amount - 1 && position > node->children[index]->length) {
+        position -= node->children[index]->length;
+        index++;
+    }
+
+    BA_Rope_Node* split = BA_Rope_InsertNode(rope, node->children[index], position, string, length, newlines);
+
+    node->length += length;
+    node->newlines += newlines;
+
+    if (split == NULL)
+        return NULL;
+
+    memmove(&node->children[index + 2], &node->children[index + 1], (node->amount - index - 1) * sizeof(BA_Rope_Node*));
+
+    node->children[index + 1] = split;
+    node->amount++;
+
+    if (node->amount <= BA_ROPE_MAX_CHILDREN)
+        return NULL;
+
+    BA_Rope_Node* right = BA_Rope_TakeNode(rope, BA_BOOLEAN_FALSE);
+    int half = node->amount / 2;
+
+    right->amount = node->amount - half;
+    node->amount = half;
+
+    memcpy(right->children, &node->children[half], right->amount * sizeof(BA_Rope_Node*));
+    BA_Rope_Recalculate(node);
+    BA_Rope_Recalculate(right);
+    return right;
+}
+
+static BA_Boolean BA_Rope_IsUnderfull(const BA_Rope_Node* node) {
+    return node->leaf ? node->length < BA_ROPE_MINIMUM_CHUNK_SIZE : node->amount < BA_ROPE_MINIMUM_CHILDREN;
+}
+
+/**
+ * Merges the child at index with a sibling, or evens them out if they don't fit in one node
+ * @return The index of the merged node, -1 if they got evened out instead
+ */
+static int BA_Rope_Rebalance(BA_Rope* rope, BA_Rope_Node* node, int index) {
+    int leftIndex = index + 1 < node->amount ? index : index - 1;
+    BA_Rope_Node* left = node->children[leftIndex];
+    BA_Rope_Node* right = node->children[leftIndex + 1];
+
+    if (left->leaf) {
+        if (left->length + right->length <= BA_ROPE_CHUNK_SIZE) {
+            memcpy(left->text + left->length, right->text, right->length);
+
+            left->length += right->length;
+            left->newlines += right->newlines;
+
+            BA_Rope_RemoveChild(node, leftIndex + 1);
+            BA_Rope_GiveNode(rope, right);
+            return leftIndex;
+        }
+
+        size_t half = (left->length + right->length) / 2;
+
+        if (left->length < half) {
+            size_t moving = half - left->length;
+
+            memcpy(left->text + left->length, right->text, moving);
+            memmove(right->text, right->text + moving, right->length - moving);
+
+            left->length += moving;
+            right->length -= moving;
+        } else {
+            size_t moving = left->length - half;
+
+            memmove(right->text + moving, right->text, right->length);
+            memcpy(right->text, left->text + half, moving);
+
+            left->length -= moving;
+            right->length += moving;
+        }
+
+        left->newlines = BA_Rope_CountNewlines(left->text, left->length);
+        right->newlines = BA_Rope_CountNewlines(right->text, right->length);
+        return -1;
+    }
+
+    if (left->amount + right->amount <= BA_ROPE_MAX_CHILDREN) {
+        memcpy(&left->children[left->amount], right->children, right->amount * sizeof(BA_Rope_Node*));
+
+        left->amount += right->amount;
+
+        BA_Rope_Recalculate(left);
+        BA_Rope_RemoveChild(node, leftIndex + 1);
+        BA_Rope_GiveNode(rope, right);
+        return leftIndex;
+    }
+
+    int half = (left->amount + right->amount) / 2;
+
+    if (left->amount < half) {
+        int moving = half - left->amount;
+
+        memcpy(&left->children[left->amount], right->children, moving * sizeof(BA_Rope_Node*));
+        memmove(right->children, &right->children[moving], (right->amount - moving) * sizeof(BA_Rope_Node*));
+
+        left->amount += moving;
+        right->amount -= moving;
+    } else {
+        int moving = left->amount - half;
+
+        memmove(&right->children[moving], right->children, right->amount * sizeof(BA_Rope_Node*));
+        memcpy(right->children, &left->children[half], moving * sizeof(BA_Rope_Node*));
+
+        left->amount -= moving;
+        right->amount += moving;
+    }
+
+    BA_Rope_Recalculate(left);
+    BA_Rope_Recalculate(right);
+    return -1;
+}
+
+/**
+ * @note The range has to be inside of node
+ */
+static void BA_Rope_DeleteNode(BA_Rope* rope, BA_Rope_Node* node, size_t position, size_t length) {
+    if (node->leaf) {
+        memmove(node->text + position, node->text + position + length, node->length - position - length);
+
+        node->length -= length;
+        node->newlines = BA_Rope_CountNewlines(node->text, node->length);
+        return;
+    }
+
+    size_t offset = 0;
+
+    for (int i = 0; i < node->amount && length > 0;) {
+        BA_Rope_Node* child = node->children[i];
+
+        if (position >= offset + child->length) {
+            offset += child->length;
+            i++;
+            continue;
+        }
+
+        size_t start = position - offset;
+        size_t deleting = child->length - start < length ? child->length - start : length;
+
+        length -= deleting;
+
+        if (start == 0 && deleting == child->length) {
+            BA_Rope_RemoveChild(node, i);
+            BA_Rope_FreeNode(rope, child);
+            continue;
+        }
+
+        BA_Rope_DeleteNode(rope, child, start, deleting);
+
+        offset += child->length;
+        i++;
+    }
+
+    for (int i = 0; i < node->amount && node->amount > 1;) {
+        if (!BA_Rope_IsUnderfull(node->children[i])) {
+            i++;
+            continue;
+        }
+
+        int merged = BA_Rope_Rebalance(rope, node, i);
+
+        // A merged node might still be too small, so check it again
+        if (merged != -1)
+            i = merged;
+        else
+            i++;
+    }
+
+    BA_Rope_Recalculate(node);
+}
+
+static void BA_Rope_CopyNode(const BA_Rope_Node* node, size_t position, size_t length, char* output) {
+    if (node->leaf) {
+        memcpy(output, node->text + position, length);
+        return;
+    }
+
+    for (int i = 0; i < node->amount && length > 0; i++) {
+        const BA_Rope_Node* child = node->children[i];
+
+        if (position >= child->length) {
+            position -= child->length;
+            continue;
+        }
+
+        size_t copying = child->length - position < length ? child->length - position : length;
+
+        BA_Rope_CopyNode(child, position, copying, output);
+
+        output += copying;
+        length -= copying;
+        position = 0;
+    }
+}
+
+BA_Rope* BA_Rope_Create(const char* string) {
+    return BA_Rope_CreateLength(string, string != NULL ? strlen(string) : 0);
+}
+
+BA_Rope* BA_Rope_CreateLength(const char* string, size_t length) {
+    BA_Rope* rope = malloc(sizeof(BA_Rope));
+
+    if (rope == NULL)
+        return NULL;
+
+    rope->height = 1;
+    rope->spareAmount = 0;
+
+    if (!BA_Rope_Reserve(rope, 1)) {
+        free(rope);
+        return NULL;
+    }
+
+    rope->root = BA_Rope_TakeNode(rope, BA_BOOLEAN_TRUE);
+
+    if (string != NULL && !BA_Rope_InsertLength(rope, 0, string, length)) {
+        BA_Rope_Free(rope);
+        return NULL;
+    }
+
+    return rope;
+}
+
+void BA_Rope_Free(BA_Rope* rope) {
+    BA_Rope_FreeNode(rope, rope->root);
+
+    for (int i = 0; i < rope->spareAmount; i++)
+        free(rope->spareNodes[i]);
+
+    free(rope);
+}
+
+size_t BA_Rope_GetLength(const BA_Rope* rope) {
+    return rope->root->length;
+}
+
+char BA_Rope_GetCharacter(const BA_Rope* rope, size_t position) {
+    const BA_Rope_Node* node = rope->root;
+
+    if (position >= node->length)
+        return '\0';
+
+    while (!node->leaf) {
+        int index = 0;
+
+        while (position >= node->children[index]->length) {
+            position -= node->children[index]->length;
+            index++;
+        }
+
+        node = node->children[index];
+    }
+
+    return node->text[position];
+}
+
+BA_Boolean BA_Rope_Insert(BA_Rope* rope, size_t position, const char* string) {
+    return BA_Rope_InsertLength(rope, position, string, strlen(string));
+}
+
+BA_Boolean BA_Rope_InsertLength(BA_Rope* rope, size_t position, const char* string, size_t length) {
+    if (position > rope->root->length)
+        return BA_BOOLEAN_FALSE;
+
+    while (length > 0) {
+        size_t piece = length > BA_ROPE_INSERT_PIECE_SIZE ? BA_ROPE_INSERT_PIECE_SIZE : length;
+
+        // Worst case every level splits, and we need a new root
+        if (!BA_Rope_Reserve(rope, rope->height + 1))
+            return BA_BOOLEAN_FALSE;
+
+        BA_Rope_Node* split = BA_Rope_InsertNode(rope, rope->root, position, string, piece, BA_Rope_CountNewlines(string, piece));
+
+        if (split != NULL) {
+            BA_Rope_Node* root = BA_Rope_TakeNode(rope, BA_BOOLEAN_FALSE);
+
+            root->children[0] = rope->root;
+            root->children[1] = split;
+            root->amount = 2;
+
+            BA_Rope_Recalculate(root);
+
+            rope->root = root;
+            rope->height++;
+        }
+
+        position += piece;
+        string += piece;
+        length -= piece;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_Rope_Append(BA_Rope* rope, const char* string) {
+    return BA_Rope_Insert(rope, rope->root->length, string);
+}
+
+BA_Boolean BA_Rope_Prepend(BA_Rope* rope, const char* string) {
+    return BA_Rope_Insert(rope, 0, string);
+}
+
+void BA_Rope_Delete(BA_Rope* rope, size_t position, size_t length) {
+    if (position >= rope->root->length || length == 0)
+        return;
+
+    if (length > rope->root->length - position)
+        length = rope->root->length - position;
+
+    BA_Rope_DeleteNode(rope, rope->root, position, length);
+
+    while (!rope->root->leaf && rope->root->amount <= 1) {
+        BA_Rope_Node* root = rope->root;
+
+        if (root->amount == 0) {
+            // Everything got deleted
+            root->leaf = BA_BOOLEAN_TRUE;
+            rope->height = 1;
+            break;
+        }
+
+        rope->root = root->children[0];
+        rope->height--;
+
+        BA_Rope_GiveNode(rope, root);
+    }
+}
+
+BA_Boolean BA_Rope_Replace(BA_Rope* rope, size_t position, size_t length, const char* string) {
+    if (position > rope->root->length)
+        return BA_BOOLEAN_FALSE;
+
+    BA_Rope_Delete(rope, position, length);
+    return BA_Rope_Insert(rope, position, string);
+}
+
+char* BA_Rope_ToString(const BA_Rope* rope) {
+    return BA_Rope_GetSubstring(rope, 0, rope->root->length);
+}
+
+char* BA_Rope_GetSubstring(const BA_Rope* rope, size_t position, size_t length) {
+    if (position > rope->root->length)
+        return NULL;
+
+    if (length > rope->root->length - position)
+        length = rope->root->length - position;
+
+    char* string = malloc(length + 1);
+
+    if (string == NULL)
+        return NULL;
+
+    BA_Rope_CopyNode(rope->root, position, length, string);
+
+    string[length] = '\0';
+    return string;
+}
+
+size_t BA_Rope_GetLineAmount(const BA_Rope* rope) {
+    return rope->root->newlines + 1;
+}
+
+size_t BA_Rope_GetLineStart(const BA_Rope* rope, size_t line) {
+    const BA_Rope_Node* node = rope->root;
+    size_t offset = 0;
+
+    if (line == 0)
+        return 0;
+
+    if (line > node->newlines)
+        return BA_ROPE_NOT_FOUND;
+
+    // Find the newline that ends the previous line
+    while (!node->leaf) {
+        int index = 0;
+
+        while (line > node->children[index]->newlines) {
+            line -= node->children[index]->newlines;
+            offset += node->children[index]->length;
+            index++;
+        }
+
+        node = node->children[index];
+    }
+
+    for (size_t i = 0;; i++) {
+        if (node->text[i] == '\n' && --line == 0)
+            return offset + i + 1;
+    }
+}
+
+size_t BA_Rope_GetLineFromPosition(const BA_Rope* rope, size_t position) {
+    const BA_Rope_Node* node = rope->root;
+    size_t line = 0;
+
+    if (position >= node->length)
+        return node->newlines;
+
+    while (!node->leaf) {
+        int index = 0;
+
+        while (position >= node->children[index]->length) {
+            position -= node->children[index]->length;
+            line += node->children[index]->newlines;
+            index++;
+        }
+
+        node = node->children[index];
+    }
+
+    return line + BA_Rope_CountNewlines(node->text, position);
+}
+
+char* BA_Rope_GetLine(const BA_Rope* rope, size_t line) {
+    size_t start = BA_Rope_GetLineStart(rope, line);
+
+    if (start == BA_ROPE_NOT_FOUND)
+        return NULL;
+
+    size_t end = line < rope->root->newlines ? BA_Rope_GetLineStart(rope, line + 1) - 1 : rope->root->length;
+
+    return BA_Rope_GetSubstring(rope, start, end - start);
+}
+
+BA_DynamicArray* BA_Rope_SplitLines(const BA_Rope* rope) {
+    size_t lineAmount = BA_Rope_GetLineAmount(rope);
+    BA_DynamicArray* dynamicArray = malloc(sizeof(BA_DynamicArray));
+
+    if (dynamicArray == NULL)
+        return NULL;
+
+    if (!BA_DynamicArray_Create(dynamicArray, lineAmount)) {
+        free(dynamicArray);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < lineAmount; i++) {
+        char* line = BA_Rope_GetLine(rope, i);
+
+        if (line == NULL || !BA_DynamicArray_AddElementToLast(dynamicArray, line)) {
+            free(line);
+
+            for (int j = 0; j < dynamicArray->used; j++)
+                free(dynamicArray->internalArray[j]);
+
+            free(dynamicArray->internalArray);
+            free(dynamicArray);
+            return NULL;
+        }
+    }
+
+    return dynamicArray;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
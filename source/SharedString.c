@@ -0,0 +1,139 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BaconAPI/SharedString.h"
+#include "BaconAPI/Atomic.h"
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Sits right before the string, so the string pointer is all we need to get back to it
+ */
+typedef struct {
+    BA_Atomic_Integer referenceCount;
+    size_t length;
+    size_t capacity;
+} BA_SharedString_Header;
+
+#define BA_SHAREDSTRING_GET_HEADER(sharedString) ((BA_SharedString_Header*) (sharedString) - 1)
+
+static BA_SharedString_Header* BA_SharedString_AllocateHeader(const char* string, size_t length, size_t capacity) {
+    BA_SharedString_Header* header = malloc(sizeof(BA_SharedString_Header) + capacity + 1);
+
+    if (header == NULL)
+        return NULL;
+
+    header->referenceCount = 1;
+    header->length = length;
+    header->capacity = capacity;
+
+    memcpy(header + 1, string, length);
+
+    ((char*) (header + 1))[length] = '\0';
+    return header;
+}
+
+const char* BA_SharedString_Create(const char* string) {
+    if (string == NULL)
+        return NULL;
+
+    return BA_SharedString_CreateLength(string, strlen(string));
+}
+
+const char* BA_SharedString_CreateLength(const char* string, size_t length) {
+    if (string == NULL)
+        return NULL;
+
+    BA_SharedString_Header* header = BA_SharedString_AllocateHeader(string, length, length);
+
+    return header != NULL ? (const char*) (header + 1) : NULL;
+}
+
+const char* BA_SharedString_Retain(const char* sharedString) {
+    if (sharedString != NULL)
+        BA_ATOMIC_INCREMENT(&BA_SHAREDSTRING_GET_HEADER(sharedString)->referenceCount);
+
+    return sharedString;
+}
+
+void BA_SharedString_Release(const char* sharedString) {
+    if (sharedString == NULL)
+        return;
+
+    BA_SharedString_Header* header = BA_SHAREDSTRING_GET_HEADER(sharedString);
+
+    if (BA_ATOMIC_DECREMENT(&header->referenceCount) == 0)
+        free(header);
+}
+
+size_t BA_SharedString_GetLength(const char* sharedString) {
+    return BA_SHAREDSTRING_GET_HEADER(sharedString)->length;
+}
+
+long BA_SharedString_GetReferenceCount(const char* sharedString) {
+    return BA_ATOMIC_LOAD(&BA_SHAREDSTRING_GET_HEADER(sharedString)->referenceCount);
+}
+
+char* BA_SharedString_GetMutable(const char** sharedString) {
+    BA_SharedString_Header* header = BA_SHAREDSTRING_GET_HEADER(*sharedString);
+
+    // Nobody else can get a new reference without going through us, so this can't change under our feet
+    if (BA_ATOMIC_LOAD(&header->referenceCount) == 1)
+        return (char*) *sharedString;
+
+    BA_SharedString_Header* copy = BA_SharedString_AllocateHeader(*sharedString, header->length, header->length);
+
+    if (copy == NULL)
+        return NULL;
+
+    BA_SharedString_Release(*sharedString);
+
+    *sharedString = (const char*) (copy + 1);
+    return (char*) (copy + 1);
+}
+
+BA_Boolean BA_SharedString_Append(const char** sharedString, const char* string) {
+    return BA_SharedString_AppendLength(sharedString, string, strlen(string));
+}
+
+BA_Boolean BA_SharedString_AppendLength(const char** sharedString, const char* string, size_t length) {
+    BA_SharedString_Header* header = BA_SHAREDSTRING_GET_HEADER(*sharedString);
+    size_t newLength = header->length + length;
+    const char* oldString = NULL;
+
+    if (BA_ATOMIC_LOAD(&header->referenceCount) != 1) {
+        header = BA_SharedString_AllocateHeader(*sharedString, header->length, newLength + newLength / 2);
+
+        if (header == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        // Keep our reference until we're done copying, string might be pointing into it
+        oldString = *sharedString;
+    } else if (newLength > header->capacity) {
+        size_t capacity = header->capacity * 2 > newLength ? header->capacity * 2 : newLength;
+        BA_Boolean appendingSelf = string >= *sharedString && string <= *sharedString + header->length;
+        size_t offset = appendingSelf ? (size_t) (string - *sharedString) : 0;
+        BA_SharedString_Header* newHeader = realloc(header, sizeof(BA_SharedString_Header) + capacity + 1);
+
+        if (newHeader == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        header = newHeader;
+        header->capacity = capacity;
+
+        if (appendingSelf)
+            string = (const char*) (header + 1) + offset;
+    }
+
+    memcpy((char*) (header + 1) + header->length, string, length);
+
+    ((char*) (header + 1))[newLength] = '\0';
+    header->length = newLength;
+    *sharedString = (const char*) (header + 1);
+
+    BA_SharedString_Release(oldString);
+    return BA_BOOLEAN_TRUE;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -54,6 +54,7 @@ BA_Boolean BA_DynamicArray_Create(BA_DynamicArray* array, size_t size) {
     array->frozen = BA_BOOLEAN_FALSE;
     array->calledReallocate = 0;
     array->originalSize = size;
+    array->modifications = 0;
     return BA_BOOLEAN_TRUE;
 }
 
@@ -66,6 +67,7 @@ BA_Boolean BA_DynamicArray_AddElementToStart(BA_DynamicArray* array, void* eleme
 
     array->internalArray[0] = element;
     array->used++;
+    array->modifications++;
     return BA_BOOLEAN_TRUE;
 }
 
@@ -74,6 +76,7 @@ BA_Boolean BA_DynamicArray_AddElementToLast(BA_DynamicArray* array, void* elemen
         return BA_BOOLEAN_FALSE;
     
     array->internalArray[array->used++] = element;
+    array->modifications++;
     return BA_BOOLEAN_TRUE;
 }
 
@@ -86,6 +89,7 @@ BA_Boolean BA_DynamicArray_RemoveLastElement(BA_DynamicArray* array) {
         return BA_BOOLEAN_FALSE;
 
     array->internalArray[--array->used] = NULL;
+    array->modifications++;
     return BA_BOOLEAN_TRUE;
 }
 
@@ -97,6 +101,7 @@ BA_Boolean BA_DynamicArray_RemoveElementAt(BA_DynamicArray* array, unsigned inde
         array->internalArray[id] = array->internalArray[id + 1];
 
     array->used--;
+    array->modifications++;
     return BA_BOOLEAN_TRUE;
 }
 
@@ -124,6 +129,15 @@ BA_Boolean BA_DynamicArray_RemoveMatchedElement(BA_DynamicArray* array, const vo
     return removedOne;
 }
 
+BA_Boolean BA_DynamicArray_ReplaceElementAt(BA_DynamicArray* array, unsigned int index, void* element) {
+    if ((int) index >= array->used || array->frozen)
+        return BA_BOOLEAN_FALSE;
+
+    array->internalArray[index] = element;
+    array->modifications++;
+    return BA_BOOLEAN_TRUE;
+}
+
 BA_Boolean BA_DynamicArray_Shrink(BA_DynamicArray* array) {
     if (array->size == array->used || array->frozen)
         return BA_BOOLEAN_FALSE;
@@ -136,6 +150,7 @@ BA_Boolean BA_DynamicArray_Shrink(BA_DynamicArray* array) {
         return BA_BOOLEAN_FALSE;
     
     array->internalArray = newArray;
+    array->modifications++; // Anything holding onto the old array can't use it anymore
     return BA_BOOLEAN_TRUE;
 }
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -17,6 +17,7 @@ BA_Boolean BA_DynamicDictionary_Create(BA_DynamicDictionary* dictionary, size_t
                              BA_DynamicArray_Create(&dictionary->values, size);
 
     dictionary->frozen = BA_BOOLEAN_FALSE;
+    dictionary->lookupIndex = NULL;
     return returnValue;
 }
 
@@ -25,24 +25,29 @@ BA_STRINGIMPLEMENTATION_CREATE(String)
 char* BA_String_ReadFile(FILE* file, size_t lengthLimit, size_t* lineLength) {
     fseek(file, 0, SEEK_END);
     
-    size_t numberOfBytes = ftell(file);
+    long position = ftell(file);
+
+    // Pipes can't seek
+    if (position < 0)
+        return NULL;
+
+    size_t numberOfBytes = (size_t) position;
 
     fseek(file, 0, SEEK_SET);
 
     if (lengthLimit != 0 && numberOfBytes > lengthLimit)
         numberOfBytes = lengthLimit;
     
-    char* buffer = calloc(1, sizeof(char) * numberOfBytes);
+    char* buffer = malloc(sizeof(char) * (numberOfBytes + 1));
     
     if (buffer == NULL)
         return NULL;
 
+    numberOfBytes = fread(buffer, sizeof(char), numberOfBytes, file);
+
     if (lineLength != NULL)
         *lineLength = numberOfBytes;
 
-    buffer[0] = '\0';
-
-    fread(buffer, sizeof(char), numberOfBytes, file);
     fseek(file, 0, SEEK_SET);
 
     buffer[numberOfBytes] = '\0';
@@ -50,53 +55,61 @@ char* BA_String_ReadFile(FILE* file, size_t lengthLimit, size_t* lineLength) {
 }
 
 intmax_t BA_String_GetLine(FILE* file, char** line, const char* splitString) {
-    const char* currentSplitString = splitString != NULL ? splitString : "\n";
-    intmax_t length = 0;
-    char* buffer = NULL;
-    intmax_t splitStringLength = (int) strlen(currentSplitString);
-
-    if (line != NULL) {
-        buffer = BA_String_CreateEmpty();
-                
-        if (buffer == NULL)
-            return -2;
-    }
-    
-    while (!feof(file)) {
-        char* contents = calloc(1, splitStringLength + 1);
+    const char* currentSplitString = splitString != NULL && splitString[0] != '\0' ? splitString : "\n";
+    size_t splitStringLength = strlen(currentSplitString);
+    char lastSplitCharacter = currentSplitString[splitStringLength - 1];
+    size_t length = 0;
+    size_t capacity = 64;
+    char* buffer = malloc(capacity);
+    int character;
+
+    if (buffer == NULL)
+        return -2;
 
-        contents[0] = '\0';
-        contents[splitStringLength] = '\0';
-        
-        fread(contents, sizeof(char), splitStringLength, file);
+    // getc is buffered by stdio, and reading one byte at a time means we never read past the line
+    while ((character = getc(file)) != EOF) {
+        if (length + 1 == capacity) {
+            char* newBuffer = realloc(buffer, capacity * 2);
 
-        if (BA_String_Equals(contents, currentSplitString, BA_BOOLEAN_FALSE)) {
-            if (line != NULL)
-                *line = buffer;
+            if (newBuffer == NULL) {
+                free(buffer);
+                return -2;
+            }
 
-            free(contents);
-            return length;
+            buffer = newBuffer;
+            capacity *= 2;
         }
-        
-        length += splitStringLength;
 
-        if (line == NULL) {
-            free(contents);
+        buffer[length++] = (char) character;
+
+        if ((char) character != lastSplitCharacter || length < splitStringLength ||
+            memcmp(buffer + length - splitStringLength, currentSplitString, splitStringLength) != 0)
             continue;
-        }
-        
-        buffer = BA_String_Append(buffer, contents);
-        
-        free(contents);
+
+        length -= splitStringLength;
+        buffer[length] = '\0';
+
+        if (line != NULL)
+            *line = buffer;
+        else
+            free(buffer);
+
+        return (intmax_t) length;
     }
 
-    if (line != NULL && buffer[0] != '\0') {
-        *line = buffer;
-        return length;
+    if (length == 0) {
+        free(buffer);
+        return -1;
     }
 
-    free(buffer);
-    return -1;
+    buffer[length] = '\0';
+
+    if (line != NULL)
+        *line = buffer;
+    else
+        free(buffer);
+
+    return (intmax_t) length;
 }
 
 intmax_t BA_String_GetLineCharacter(FILE* file, char** line, char splitCharacter) {
@@ -0,0 +1,190 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "BaconAPI/StringBuilder.h"
+#include "BaconAPI/Internal/Compiler.h"
+
+#define BA_STRINGBUILDER_DEFAULT_CAPACITY 64
+#define BA_STRINGBUILDER_THREAD_LOCAL_CAPACITY 512
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+static BA_COMPILER_THREAD_LOCAL char baStringBuilderThreadLocalStorage[BA_STRINGBUILDER_THREAD_LOCAL_CAPACITY];
+static BA_COMPILER_THREAD_LOCAL BA_StringBuilder baStringBuilderThreadLocal;
+static BA_COMPILER_THREAD_LOCAL BA_Boolean baStringBuilderThreadLocalInitialized = BA_BOOLEAN_FALSE;
+
+BA_Boolean BA_StringBuilder_Create(BA_StringBuilder* builder, size_t capacity) {
+    if (capacity == 0)
+        capacity = BA_STRINGBUILDER_DEFAULT_CAPACITY;
+
+    builder->buffer = malloc(sizeof(char) * capacity);
+
+    if (builder->buffer == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    builder->buffer[0] = '\0';
+    builder->length = 0;
+    builder->capacity = capacity;
+    builder->ownsBuffer = BA_BOOLEAN_TRUE;
+    return BA_BOOLEAN_TRUE;
+}
+
+void BA_StringBuilder_CreateFromBuffer(BA_StringBuilder* builder, char* buffer, size_t capacity) {
+    buffer[0] = '\0';
+    builder->buffer = buffer;
+    builder->length = 0;
+    builder->capacity = capacity;
+    builder->ownsBuffer = BA_BOOLEAN_FALSE;
+}
+
+BA_Boolean BA_StringBuilder_Reserve(BA_StringBuilder* builder, size_t extraLength) {
+    size_t neededCapacity = builder->length + extraLength + 1;
+
+    if (neededCapacity <= builder->capacity)
+        return BA_BOOLEAN_TRUE;
+
+    size_t newCapacity = builder->capacity * 2;
+
+    if (newCapacity < neededCapacity)
+        newCapacity = neededCapacity;
+
+    char* newBuffer;
+
+    if (builder->ownsBuffer)
+        newBuffer = realloc(builder->buffer, sizeof(char) * newCapacity);
+    else {
+        newBuffer = malloc(sizeof(char) * newCapacity);
+
+        if (newBuffer != NULL)
+            memcpy(newBuffer, builder->buffer, builder->length + 1);
+    }
+
+    if (newBuffer == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    builder->buffer = newBuffer;
+    builder->capacity = newCapacity;
+    builder->ownsBuffer = BA_BOOLEAN_TRUE;
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_StringBuilder_Append(BA_StringBuilder* builder, const char* string) {
+    return string != NULL && BA_StringBuilder_AppendLength(builder, string, strlen(string));
+}
+
+BA_Boolean BA_StringBuilder_AppendLength(BA_StringBuilder* builder, const char* string, size_t length) {
+    if (!BA_StringBuilder_Reserve(builder, length))
+        return BA_BOOLEAN_FALSE;
+
+    memcpy(builder->buffer + builder->length, string, length);
+
+    builder->length += length;
+    builder->buffer[builder->length] = '\0';
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_StringBuilder_AppendCharacter(BA_StringBuilder* builder, char character) {
+    if (!BA_StringBuilder_Reserve(builder, 1))
+        return BA_BOOLEAN_FALSE;
+
+    builder->buffer[builder->length++] = character;
+    builder->buffer[builder->length] = '\0';
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_StringBuilder_AppendFormat(BA_StringBuilder* builder, const char* format, ...) {
+    va_list arguments;
+
+    va_start(arguments, format);
+
+    BA_Boolean result = BA_StringBuilder_AppendFormatPremadeList(builder, format, arguments);
+
+    va_end(arguments);
+    return result;
+}
+
+BA_Boolean BA_StringBuilder_AppendFormatPremadeList(BA_StringBuilder* builder, const char* format, va_list arguments) {
+    va_list argumentsCopy;
+    size_t freeSpace = builder->capacity - builder->length;
+
+    va_copy(argumentsCopy, arguments);
+
+    int length = vsnprintf(builder->buffer + builder->length, freeSpace, format, argumentsCopy);
+
+    va_end(argumentsCopy);
+
+    if (length < 0) {
+        builder->buffer[builder->length] = '\0';
+        return BA_BOOLEAN_FALSE;
+    }
+
+    if ((size_t) length >= freeSpace) {
+        if (!BA_StringBuilder_Reserve(builder, length)) {
+            builder->buffer[builder->length] = '\0';
+            return BA_BOOLEAN_FALSE;
+        }
+
+        vsnprintf(builder->buffer + builder->length, length + 1, format, arguments);
+    }
+
+    builder->length += length;
+    return BA_BOOLEAN_TRUE;
+}
+
+void BA_StringBuilder_Clear(BA_StringBuilder* builder) {
+    builder->length = 0;
+    builder->buffer[0] = '\0';
+}
+
+char* BA_StringBuilder_Finish(BA_StringBuilder* builder) {
+    char* result = builder->buffer;
+
+    if (!builder->ownsBuffer) {
+        result = malloc(sizeof(char) * (builder->length + 1));
+
+        if (result == NULL)
+            return NULL;
+
+        memcpy(result, builder->buffer, builder->length + 1);
+    }
+
+    builder->buffer = NULL;
+    builder->length = 0;
+    builder->capacity = 0;
+    builder->ownsBuffer = BA_BOOLEAN_FALSE;
+    return result;
+}
+
+void BA_StringBuilder_Free(BA_StringBuilder* builder) {
+    if (builder->ownsBuffer)
+        free(builder->buffer);
+
+    builder->buffer = NULL;
+    builder->length = 0;
+    builder->capacity = 0;
+    builder->ownsBuffer = BA_BOOLEAN_FALSE;
+}
+
+BA_StringBuilder* BA_StringBuilder_GetThreadLocal(void) {
+    if (!baStringBuilderThreadLocalInitialized) {
+        BA_StringBuilder_CreateFromBuffer(&baStringBuilderThreadLocal, baStringBuilderThreadLocalStorage, BA_STRINGBUILDER_THREAD_LOCAL_CAPACITY);
+
+        baStringBuilderThreadLocalInitialized = BA_BOOLEAN_TRUE;
+    }
+
+    BA_StringBuilder_Clear(&baStringBuilderThreadLocal);
+    return &baStringBuilderThreadLocal;
+}
+
+void BA_StringBuilder_FreeThreadLocal(void) {
+    if (!baStringBuilderThreadLocalInitialized)
+        return;
+
+    BA_StringBuilder_Free(&baStringBuilderThreadLocal);
+
+    baStringBuilderThreadLocalInitialized = BA_BOOLEAN_FALSE;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
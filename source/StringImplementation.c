@@ -13,6 +13,11 @@
 #include "BaconAPI/StringSafeFormat.h"
 #include "BaconAPI/Debugging/Assert.h"
 #include "BaconAPI/OperatingSystem.h"
+#include "BaconAPI/Number.h"
+#include "BaconAPI/Unicode.h"
+
+#define BA_STRINGIMPLEMENTATION_FORMAT_STACK_SIZE 256
+#define BA_STRINGIMPLEMENTATION_FORMAT_WIDE_LIMIT (1 << 24)
 
 #if BA_OPERATINGSYSTEM_WINDOWS
 #   define strtok_r strtok_s // I hate Microshit so much. Stop trying to be unique and quirky
@@ -182,9 +187,6 @@ BA_Boolean BA_StringImplementation_Equals(const BA_StringImplementation* string,
 
     BA_STRINGIMPLEMENTATION_GET_LENGTH(string);
 
-    if (!caseless)
-        goto check;
-
     {
         size_t compareLength;
 
@@ -194,6 +196,9 @@ BA_Boolean BA_StringImplementation_Equals(const BA_StringImplementation* string,
             return BA_BOOLEAN_FALSE;
     }
 
+    if (!caseless)
+        goto check;
+
     BA_STRINGIMPLEMENTATION_GET_STRING_COMPARE(stringLength, stringLength);
 
     if (heapCompare == NULL)
@@ -436,62 +441,86 @@ BA_StringImplementation* BA_StringImplementation_FormatPremadeList(BA_StringImpl
     BA_STRINGIMPLEMENTATION_CHECK_IF_NULL(target, NULL);
 
     va_list argumentsCopy;
+    void* newString;
 
     va_copy(argumentsCopy, arguments);
 
-    size_t newLength = 1;
-    BA_StringImplementation* newBuffer = malloc(sizeof(BA_StringImplementation));
-
     if (target->isWideString) {
-        static FILE* dummyFile = NULL;
-
-        // This is disgusting
-        if (dummyFile == NULL) {
-#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
-            dummyFile = fopen("/dev/null", "wb");
-#elif BA_OPERATINGSYSTEM_WINDOWS
-            dummyFile = fopen("NUL", "wb");
-#endif
+        // vswprintf doesn't tell us how big the buffer has to be, so keep growing it until everything fits
+        wchar_t stackBuffer[BA_STRINGIMPLEMENTATION_FORMAT_STACK_SIZE];
+        wchar_t* buffer = stackBuffer;
+        size_t capacity = BA_STRINGIMPLEMENTATION_FORMAT_STACK_SIZE;
+        int length;
+
+        while ((length = vswprintf(buffer, capacity, target->wideString, argumentsCopy)) < 0) {
+            va_end(argumentsCopy);
+
+            if (buffer != stackBuffer)
+                free(buffer);
+
+            capacity *= 2;
+
+            if (capacity > BA_STRINGIMPLEMENTATION_FORMAT_WIDE_LIMIT || (buffer = malloc(sizeof(wchar_t) * capacity)) == NULL)
+                return NULL;
+
+            va_copy(argumentsCopy, arguments);
         }
 
-        newLength += vfwprintf(dummyFile, target->wideString, arguments);
-    } else
-        newLength += vsnprintf(NULL, 0, target->string, arguments);
-    
-    if (newBuffer == NULL) {
         va_end(argumentsCopy);
-        return NULL;
+
+        if (buffer == stackBuffer) {
+            newString = malloc(sizeof(wchar_t) * (length + 1));
+
+            if (newString == NULL)
+                return NULL;
+
+            wmemcpy(newString, buffer, length + 1);
+        } else
+            newString = buffer;
+    } else {
+        char stackBuffer[BA_STRINGIMPLEMENTATION_FORMAT_STACK_SIZE];
+        int length = vsnprintf(stackBuffer, sizeof(stackBuffer), target->string, argumentsCopy);
+
+        va_end(argumentsCopy);
+
+        if (length < 0)
+            return NULL;
+
+        newString = malloc(sizeof(char) * (length + 1));
+
+        if (newString == NULL)
+            return NULL;
+
+        // Only format a second time if the stack buffer was too small
+        if (length < (int) sizeof(stackBuffer))
+            memcpy(newString, stackBuffer, length + 1);
+        else
+            vsnprintf(newString, length + 1, target->string, arguments);
     }
-    
-    newBuffer->isWideString = target->isWideString;
-    
+
     if (target->isWideString) {
-        size_t length = wcslen(target->wideString);
-        newBuffer->wideString = calloc(1, sizeof(wchar_t) * (newLength + length));
-        
-        if (newBuffer->wideString == NULL) {
-            free(newBuffer);
-            return NULL;
-        }
+        free(target->wideString);
 
-        wcsncpy(newBuffer->wideString, target->wideString, length);
+        target->wideString = newString;
     } else {
-        size_t length = strlen(target->string);
-        
-        newBuffer->string = calloc(1, sizeof(char) * (newLength + length));
+        free(target->string);
 
-        if (newBuffer->string == NULL) {
-            free(newBuffer);
-            return NULL;
-        }
-        
-        strncpy(newBuffer->string, target->string, length);
+        target->string = newString;
     }
 
-    target->isWideString ? vswprintf(newBuffer->wideString, newLength, target->wideString, argumentsCopy) : vsnprintf(newBuffer->string, newLength, target->string, argumentsCopy);
-    va_end(argumentsCopy);
-    BA_STRINGIMPLEMENTATION_FREE(target);
-    return newBuffer;
+    return target;
+}
+
+int BA_StringImplementation_FormatInto(BA_StringImplementation* buffer, size_t capacity, const BA_StringImplementation* format, va_list arguments) {
+    BA_STRINGIMPLEMENTATION_CHECK_IF_NULL(format, -1);
+
+    if (buffer == NULL || (capacity != 0 && buffer->string == NULL)) // NOTE: string, and wideString occupy the same space
+        return -1;
+
+    if (format->isWideString)
+        return capacity != 0 ? vswprintf(buffer->wideString, capacity, format->wideString, arguments) : -1;
+
+    return vsnprintf(buffer->string, capacity, format->string, arguments);
 }
 
 BA_DynamicArray* BA_StringImplementation_Split(const BA_StringImplementation* target, const BA_StringImplementation* splitBy) {
@@ -545,156 +574,347 @@ BA_DynamicArray* BA_StringImplementation_SplitCharacter(const BA_StringImplement
     return BA_StringImplementation_Split(target, &temporaryString);
 }
 
-BA_StringImplementation* BA_StringImplementation_FormatSafePremadeList(BA_StringImplementation* target, int amountOfFormatters, va_list arguments) {
-    BA_StringImplementation_Initialize();
+BA_Boolean BA_StringImplementation_ParseSafeFormat(BA_StringSafeFormat_Template* compiledTemplate, const BA_StringImplementation* target) {
+    BA_STRINGIMPLEMENTATION_CHECK_IF_NULL(target, BA_BOOLEAN_FALSE);
 
-    BA_STRINGIMPLEMENTATION_CHECK_IF_NULL(target, NULL);
-    
     size_t targetLength;
 
     BA_STRINGIMPLEMENTATION_GET_LENGTH(target);
 
-    if (targetLength == 0 || amountOfFormatters <= 0)
-        return target;
+    compiledTemplate->templateString = (void*) target->string; // NOTE: string, and wideString occupy the same space, so this wouldn't matter
+    compiledTemplate->templateLength = targetLength;
+    compiledTemplate->isWideString = target->isWideString;
+    compiledTemplate->slotPositions = NULL;
+    compiledTemplate->slotAmount = 0;
 
-    BA_StringImplementation* newBuffer = BA_StringImplementation_CreateEmpty(target->isWideString);
+    // First pass counts the slots, second pass records where they are
+    for (int pass = 0; pass < 2; pass++) {
+        BA_Boolean percentageFound = BA_BOOLEAN_FALSE;
+        int slot = 0;
 
-    if (newBuffer == NULL)
-        return NULL;
+        if (pass == 1) {
+            if (compiledTemplate->slotAmount == 0)
+                break;
 
-    BA_Boolean percentageFound = BA_BOOLEAN_FALSE;
-    int usedArguments = 0;
-    int lastSuccessfulIdentifier = 0;
+            compiledTemplate->slotPositions = malloc(sizeof(size_t) * compiledTemplate->slotAmount);
 
-    for (int i = 0; i < targetLength; i++) {
-        if (target->isWideString ? target->wideString[i] == L'%' : target->string[i] == '%') {
-            if (!percentageFound) {
-                percentageFound = BA_BOOLEAN_TRUE;
+            if (compiledTemplate->slotPositions == NULL)
+                return BA_BOOLEAN_FALSE;
+        }
+
+        for (size_t i = 0; i < targetLength; i++) {
+            if (target->isWideString ? target->wideString[i] == L'%' : target->string[i] == '%') {
+                percentageFound = !percentageFound;
                 continue;
             }
 
-            if (target->isWideString)
-                newBuffer->wideString = BA_WideString_Append(newBuffer->wideString, L"%%");
-            else
-                newBuffer->string = BA_String_Append(newBuffer->string, "%%");
+            if (!percentageFound)
+                continue;
 
             percentageFound = BA_BOOLEAN_FALSE;
-            continue;
-        }
 
-        if (percentageFound) {
-            percentageFound = BA_BOOLEAN_FALSE;
+            if (target->isWideString ? target->wideString[i] != L's' : target->string[i] != 's')
+                continue;
 
-            if (target->isWideString ? target->wideString[i] == L's' : target->string[i] == 's') {
-                if (usedArguments >= amountOfFormatters) {
-                    if (target->isWideString)
-                        newBuffer->wideString = BA_WideString_Append(newBuffer->wideString, L"%s");
-                    else
-                        newBuffer->string = BA_String_Append(newBuffer->string, "%s");
+            if (pass == 0)
+                compiledTemplate->slotAmount++;
+            else
+                compiledTemplate->slotPositions[slot++] = i - 1;
+        }
+    }
 
-                    continue;
-                }
+    return BA_BOOLEAN_TRUE;
+}
 
-                usedArguments++;
-
-#define BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(type, formatSpecifier) \
-do {                                                                      \
-    type value = va_arg(arguments, type);                                 \
-    size_t bufferSize;                                                    \
-    if (target->isWideString) {                                           \
-        bufferSize = swprintf(NULL, 0, L ## formatSpecifier, value);      \
-        wchar_t* buffer = calloc(1, bufferSize);                          \
-        swprintf(buffer, bufferSize + 1, L ## formatSpecifier, value);    \
-        newBuffer->wideString = BA_WideString_Append(newBuffer->wideString, buffer); \
-        free(buffer);                                                     \
-    } else {                                                              \
-        bufferSize = snprintf(NULL, 0, formatSpecifier, value);           \
-        char* buffer = calloc(1, bufferSize);                             \
-        snprintf(buffer, bufferSize + 1, formatSpecifier, value);         \
-        newBuffer->string = BA_String_Append(newBuffer->string, buffer);  \
-        free(buffer);                                                     \
-    }                                                                     \
+#define BA_STRINGIMPLEMENTATION_SAFE_FORMAT_INLINE_SIZE 48
+#define BA_STRINGIMPLEMENTATION_SAFE_FORMAT_STACK_PIECES 8
+
+typedef struct {
+    const void* data;
+    size_t length;
+    BA_Boolean isWideString;
+    BA_Boolean allocated;
+    union {
+        char string[BA_STRINGIMPLEMENTATION_SAFE_FORMAT_INLINE_SIZE];
+        wchar_t wideString[2];
+    } inlineBuffer;
+} BA_StringImplementation_SafeFormatPiece;
+
+#define BA_STRINGIMPLEMENTATION_RENDER_INTEGER(type, castType, function) \
+do {                                                                       \
+    piece->length = function((castType) (type) va_arg(*arguments, type), piece->inlineBuffer.string); \
+    piece->data = piece->inlineBuffer.string;                              \
 } while (BA_BOOLEAN_FALSE)
 
-                BA_StringSafeFormat_Types identifier = va_arg(arguments, BA_StringSafeFormat_Types);
-
-                switch (identifier) {
-                    case BA_STRINGSAFEFORMAT_TYPE_STRING:
-                        if (target->isWideString) {
-                            wchar_t* converted = BA_WideString_Convert(va_arg(arguments, char*));
-                            
-                            newBuffer->wideString = BA_WideString_Append(newBuffer->wideString, converted);
-                            free(converted);
-                        } else
-                            newBuffer->string = BA_String_Append(newBuffer->string, va_arg(arguments, char*));
-
-                        break;
-
-                    case BA_STRINGSAFEFORMAT_TYPE_INTEGER: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(int, "%d"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_DOUBLE: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(double, "%lf"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_CHARACTER:
-                        if (target->isWideString)
-                            newBuffer->wideString = BA_WideString_AppendCharacter(newBuffer->wideString, va_arg(arguments, int));
-                        else
-                            newBuffer->string = BA_String_AppendCharacter(newBuffer->string, va_arg(arguments, int));
-
-                        break;
-
-                    case BA_STRINGSAFEFORMAT_TYPE_LONG: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(long, "%li"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_LONG_LONG: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(long long, "%lli"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_SHORT: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(int, "%hi"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(unsigned, "%u"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_LONG_DOUBLE: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(long double, "%Lf"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED_CHARACTER: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(unsigned int, "%c"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED_LONG: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(unsigned long, "%lu"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED_LONG_LONG: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(unsigned long long, "%llu"); break;
-                    case BA_STRINGSAFEFORMAT_TYPE_POINTER: BA_STRINGIMPLEMENTATION_CONVERT_AND_APPEND(void*, "%p"); break;
-                    default:
-                    {
-                        if (baStringImplementationInitialized) {
-                            BA_StringSafeFormat_CustomSafeFormatAction actionFunction = (BA_StringSafeFormat_CustomSafeFormatAction) BA_DYNAMICDICTIONARY_GET_VALUE(BA_StringSafeFormat_CustomSafeFormatAction, &baStringImplementationDynamicDictionary, &identifier, sizeof(int));
-
-                            if (actionFunction != NULL) {
-                                void* argument = va_arg(arguments, void*);
-
-                                if (target->isWideString)
-                                    newBuffer->wideString = actionFunction(newBuffer->wideString, BA_BOOLEAN_TRUE, &argument);
-                                else
-                                    newBuffer->string = actionFunction(newBuffer->string, BA_BOOLEAN_FALSE, &argument);
-                                
-                                break;
-                            }
-                        }
-
-                        BA_ASSERT_ALWAYS("Specified type is unrecognized:\nIdentifier: %i\nPrevious identifier: %i\n", identifier, lastSuccessfulIdentifier);
-                    }
-                }
+// Only used for the types that don't have their own kernel
+#define BA_STRINGIMPLEMENTATION_RENDER_NUMBER(type, formatSpecifier) \
+do {                                                                 \
+    type value = va_arg(*arguments, type);                           \
+    int length = snprintf(piece->inlineBuffer.string, BA_STRINGIMPLEMENTATION_SAFE_FORMAT_INLINE_SIZE, formatSpecifier, value); \
+    if (length < 0)                                                  \
+        return BA_BOOLEAN_FALSE;                                     \
+    piece->data = piece->inlineBuffer.string;                        \
+    piece->length = length;                                          \
+    if (length < BA_STRINGIMPLEMENTATION_SAFE_FORMAT_INLINE_SIZE)    \
+        break;                                                       \
+    char* buffer = malloc(sizeof(char) * (length + 1));              \
+    if (buffer == NULL)                                              \
+        return BA_BOOLEAN_FALSE;                                     \
+    snprintf(buffer, length + 1, formatSpecifier, value);            \
+    piece->data = buffer;                                            \
+    piece->allocated = BA_BOOLEAN_TRUE;                              \
+} while (BA_BOOLEAN_FALSE)
 
-                lastSuccessfulIdentifier = identifier;
-                continue;
+static BA_Boolean BA_StringImplementation_RenderSafeFormatPiece(BA_StringImplementation_SafeFormatPiece* piece, BA_Boolean isWideString, int* lastSuccessfulIdentifier, va_list* arguments) {
+    BA_StringSafeFormat_Types identifier = va_arg(*arguments, BA_StringSafeFormat_Types);
+
+    piece->isWideString = BA_BOOLEAN_FALSE;
+    piece->allocated = BA_BOOLEAN_FALSE;
+
+    switch (identifier) {
+        case BA_STRINGSAFEFORMAT_TYPE_STRING:
+        {
+            const char* string = va_arg(*arguments, char*);
+
+            if (string == NULL)
+                string = "(null)";
+
+            if (isWideString) {
+                wchar_t* converted = BA_WideString_Convert(string);
+
+                if (converted == NULL)
+                    return BA_BOOLEAN_FALSE;
+
+                piece->data = converted;
+                piece->length = wcslen(converted);
+                piece->isWideString = BA_BOOLEAN_TRUE;
+                piece->allocated = BA_BOOLEAN_TRUE;
+                break;
             }
 
-            if (target->isWideString)
-                newBuffer->wideString = BA_WideString_AppendCharacter(newBuffer->wideString, L'%');
-            else
-                newBuffer->string = BA_String_AppendCharacter(newBuffer->string, '%');
+            piece->data = string;
+            piece->length = strlen(string);
+            break;
         }
 
-        if (target->isWideString)
-            newBuffer->wideString = BA_WideString_AppendCharacter(newBuffer->wideString, target->wideString[i]);
-        else
-            newBuffer->string = BA_String_AppendCharacter(newBuffer->string, target->string[i]);
+        case BA_STRINGSAFEFORMAT_TYPE_INTEGER: BA_STRINGIMPLEMENTATION_RENDER_INTEGER(int, int64_t, BA_Number_LongToString); break;
+        case BA_STRINGSAFEFORMAT_TYPE_DOUBLE:
+            piece->length = BA_Number_DoubleToString(va_arg(*arguments, double), piece->inlineBuffer.string);
+            piece->data = piece->inlineBuffer.string;
+            break;
+
+        case BA_STRINGSAFEFORMAT_TYPE_CHARACTER:
+        {
+            int character = va_arg(*arguments, int);
+
+            if (isWideString) {
+                piece->inlineBuffer.wideString[0] = (wchar_t) character;
+                piece->data = piece->inlineBuffer.wideString;
+                piece->isWideString = BA_BOOLEAN_TRUE;
+            } else {
+                piece->inlineBuffer.string[0] = (char) character;
+                piece->data = piece->inlineBuffer.string;
+            }
+
+            piece->length = 1;
+            break;
+        }
+
+        case BA_STRINGSAFEFORMAT_TYPE_LONG: BA_STRINGIMPLEMENTATION_RENDER_INTEGER(long, int64_t, BA_Number_LongToString); break;
+        case BA_STRINGSAFEFORMAT_TYPE_LONG_LONG: BA_STRINGIMPLEMENTATION_RENDER_INTEGER(long long, int64_t, BA_Number_LongToString); break;
+        case BA_STRINGSAFEFORMAT_TYPE_SHORT: BA_STRINGIMPLEMENTATION_RENDER_INTEGER(int, short, BA_Number_LongToString); break;
+        case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED: BA_STRINGIMPLEMENTATION_RENDER_INTEGER(unsigned, uint64_t, BA_Number_UnsignedLongToString); break;
+        case BA_STRINGSAFEFORMAT_TYPE_LONG_DOUBLE: BA_STRINGIMPLEMENTATION_RENDER_NUMBER(long double, "%Lf"); break;
+        case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED_CHARACTER:
+            piece->inlineBuffer.string[0] = (char) (unsigned char) va_arg(*arguments, unsigned int);
+            piece->data = piece->inlineBuffer.string;
+            piece->length = 1;
+            break;
+
+        case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED_LONG: BA_STRINGIMPLEMENTATION_RENDER_INTEGER(unsigned long, uint64_t, BA_Number_UnsignedLongToString); break;
+        case BA_STRINGSAFEFORMAT_TYPE_UNSIGNED_LONG_LONG: BA_STRINGIMPLEMENTATION_RENDER_INTEGER(unsigned long long, uint64_t, BA_Number_UnsignedLongToString); break;
+        case BA_STRINGSAFEFORMAT_TYPE_POINTER: BA_STRINGIMPLEMENTATION_RENDER_NUMBER(void*, "%p"); break;
+        default:
+        {
+            if (baStringImplementationInitialized) {
+                BA_StringSafeFormat_CustomSafeFormatAction actionFunction = (BA_StringSafeFormat_CustomSafeFormatAction) BA_DYNAMICDICTIONARY_GET_VALUE(BA_StringSafeFormat_CustomSafeFormatAction, &baStringImplementationDynamicDictionary, &identifier, sizeof(int));
+
+                if (actionFunction != NULL) {
+                    void* argument = va_arg(*arguments, void*);
+                    void* buffer = isWideString ? (void*) BA_WideString_CreateEmpty() : (void*) BA_String_CreateEmpty();
+
+                    if (buffer == NULL || (buffer = actionFunction(buffer, isWideString, &argument)) == NULL)
+                        return BA_BOOLEAN_FALSE;
+
+                    piece->data = buffer;
+                    piece->length = isWideString ? wcslen(buffer) : strlen(buffer);
+                    piece->isWideString = isWideString;
+                    piece->allocated = BA_BOOLEAN_TRUE;
+                    break;
+                }
+            }
+
+            BA_ASSERT_ALWAYS("Specified type is unrecognized:\nIdentifier: %i\nPrevious identifier: %i\n", identifier, *lastSuccessfulIdentifier);
+        }
     }
 
-    if (percentageFound) {
-        if (target->isWideString)
-            newBuffer->wideString = BA_WideString_AppendCharacter(newBuffer->wideString, L'%');
+    *lastSuccessfulIdentifier = identifier;
+    return BA_BOOLEAN_TRUE;
+}
+
+void* BA_StringImplementation_ApplySafeFormat(const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, va_list arguments) {
+    BA_StringImplementation_Initialize();
+
+    if (compiledTemplate == NULL || compiledTemplate->templateString == NULL)
+        return NULL;
+
+    BA_StringImplementation_SafeFormatPiece stackPieces[BA_STRINGIMPLEMENTATION_SAFE_FORMAT_STACK_PIECES];
+    BA_StringImplementation_SafeFormatPiece* pieces = stackPieces;
+    int usedSlots = amountOfFormatters < compiledTemplate->slotAmount ? amountOfFormatters : compiledTemplate->slotAmount;
+    int renderedPieces = 0;
+    int lastSuccessfulIdentifier = 0;
+    size_t characterSize = compiledTemplate->isWideString ? sizeof(wchar_t) : sizeof(char);
+    size_t finalLength;
+    char* result = NULL;
+    va_list argumentsCopy;
+
+    if (usedSlots < 0)
+        usedSlots = 0;
+
+    if (usedSlots > BA_STRINGIMPLEMENTATION_SAFE_FORMAT_STACK_PIECES && (pieces = malloc(sizeof(BA_StringImplementation_SafeFormatPiece) * usedSlots)) == NULL)
+        return NULL;
+
+    // Size pass. Every argument gets rendered once, strings are only referenced
+    finalLength = compiledTemplate->templateLength - (size_t) usedSlots * 2;
+
+    va_copy(argumentsCopy, arguments);
+
+    for (; renderedPieces < usedSlots; renderedPieces++) {
+        if (!BA_StringImplementation_RenderSafeFormatPiece(&pieces[renderedPieces], compiledTemplate->isWideString, &lastSuccessfulIdentifier, &argumentsCopy))
+            goto cleanup;
+
+        finalLength += pieces[renderedPieces].length;
+    }
+
+    result = malloc(characterSize * (finalLength + 1));
+
+    if (result == NULL)
+        goto cleanup;
+
+    // Write pass
+    {
+        char* cursor = result;
+        size_t lastPosition = 0;
+
+        for (int i = 0; i <= usedSlots; i++) {
+            size_t position = i < usedSlots ? compiledTemplate->slotPositions[i] : compiledTemplate->templateLength;
+
+            memcpy(cursor, (const char*) compiledTemplate->templateString + lastPosition * characterSize, (position - lastPosition) * characterSize);
+
+            cursor += (position - lastPosition) * characterSize;
+            lastPosition = position + 2;
+
+            if (i == usedSlots)
+                break;
+
+            const BA_StringImplementation_SafeFormatPiece* piece = &pieces[i];
+
+            if (compiledTemplate->isWideString && !piece->isWideString) {
+                for (size_t j = 0; j < piece->length; j++)
+                    ((wchar_t*) cursor)[j] = (wchar_t) ((const unsigned char*) piece->data)[j];
+            } else
+                memcpy(cursor, piece->data, piece->length * characterSize);
+
+            cursor += piece->length * characterSize;
+        }
+
+        if (compiledTemplate->isWideString)
+            *(wchar_t*) cursor = L'\0';
         else
-            newBuffer->string = BA_String_AppendCharacter(newBuffer->string, '%');
+            *cursor = '\0';
     }
 
-    BA_STRINGIMPLEMENTATION_FREE(target);
-    return newBuffer;
+    cleanup:
+    va_end(argumentsCopy);
+
+    for (int i = 0; i < renderedPieces; i++) {
+        if (pieces[i].allocated)
+            free((void*) pieces[i].data);
+    }
+
+    if (pieces != stackPieces)
+        free(pieces);
+
+    return result;
+}
+
+BA_StringImplementation* BA_StringImplementation_FormatSafePremadeList(BA_StringImplementation* target, int amountOfFormatters, va_list arguments) {
+    BA_STRINGIMPLEMENTATION_CHECK_IF_NULL(target, NULL);
+
+    BA_StringSafeFormat_Template compiledTemplate;
+
+    if (amountOfFormatters <= 0)
+        return target;
+
+    if (!BA_StringImplementation_ParseSafeFormat(&compiledTemplate, target))
+        return NULL;
+
+    if (compiledTemplate.slotAmount == 0)
+        return target;
+
+    void* newString = BA_StringImplementation_ApplySafeFormat(&compiledTemplate, amountOfFormatters, arguments);
+
+    free(compiledTemplate.slotPositions);
+
+    if (newString == NULL)
+        return NULL;
+
+    if (target->isWideString) {
+        free(target->wideString);
+
+        target->wideString = newString;
+    } else {
+        free(target->string);
+
+        target->string = newString;
+    }
+
+    return target;
+}
+
+BA_StringSafeFormat_Template* BA_StringImplementation_CompileSafeFormat(const BA_StringImplementation* target) {
+    BA_STRINGIMPLEMENTATION_CHECK_IF_NULL(target, NULL);
+
+    BA_StringSafeFormat_Template* compiledTemplate = malloc(sizeof(BA_StringSafeFormat_Template));
+    BA_StringImplementation* copiedTarget;
+
+    if (compiledTemplate == NULL)
+        return NULL;
+
+    copiedTarget = BA_StringImplementation_Copy(target);
+
+    if (copiedTarget == NULL) {
+        free(compiledTemplate);
+        return NULL;
+    }
+
+    if (!BA_StringImplementation_ParseSafeFormat(compiledTemplate, copiedTarget)) {
+        BA_STRINGIMPLEMENTATION_FREE(copiedTarget);
+        free(compiledTemplate);
+        return NULL;
+    }
+
+    free(copiedTarget); // The template now owns the string
+    return compiledTemplate;
+}
+
+void BA_StringSafeFormat_FreeTemplate(BA_StringSafeFormat_Template* compiledTemplate) {
+    if (compiledTemplate == NULL)
+        return;
+
+    free(compiledTemplate->templateString);
+    free(compiledTemplate->slotPositions);
+    free(compiledTemplate);
 }
 
 BA_StringImplementation* BA_StringImplementation_CreateEmpty(BA_Boolean isWideString) {
@@ -829,30 +1049,53 @@ BA_StringImplementation* BA_StringImplementation_Convert(const BA_StringImplemen
 
     BA_StringImplementation* newBuffer;
     size_t size;
+    size_t convertedSize;
 
-    if (target->isWideString)
-        size = wcslen(target->wideString);
-    else
+    // wchar_t is UTF-32 on most platforms, and UTF-16 on Windows
+    if (target->isWideString) {
+        size_t wideLength = wcslen(target->wideString);
+
+#if WCHAR_MAX > 0xFFFF
+        size = BA_Unicode_GetUTF8LengthFromUTF32((const uint32_t*) target->wideString, wideLength);
+#else
+        size = BA_Unicode_GetUTF8LengthFromUTF16((const uint16_t*) target->wideString, wideLength);
+#endif
+
+        if (size == BA_UNICODE_ERROR)
+            return NULL;
+
+        BA_STRINGIMPLEMENTATION_CREATE(newBuffer, size, BA_BOOLEAN_FALSE);
+
+        if (newBuffer == NULL)
+            return NULL;
+
+#if WCHAR_MAX > 0xFFFF
+        convertedSize = BA_Unicode_UTF32ToUTF8((const uint32_t*) target->wideString, wideLength, newBuffer->string);
+#else
+        convertedSize = BA_Unicode_UTF16ToUTF8((const uint16_t*) target->wideString, wideLength, newBuffer->string);
+#endif
+    } else {
+        // Never needs more code units than there are bytes
         size = strlen(target->string);
 
-    BA_STRINGIMPLEMENTATION_CREATE(newBuffer, size, !target->isWideString);
-    
-    if (newBuffer == NULL)
-        return NULL;
-    
-    {
-        size_t returnValue = 0;
-    
-        if (target->isWideString)
-            returnValue = wcstombs(newBuffer->string, target->wideString, size);
-        else
-            returnValue = mbstowcs(newBuffer->wideString, target->string, size);
+        BA_STRINGIMPLEMENTATION_CREATE(newBuffer, size, BA_BOOLEAN_TRUE);
 
-        if (returnValue == -1) {
-            free(newBuffer);
-        }
+        if (newBuffer == NULL)
+            return NULL;
+
+#if WCHAR_MAX > 0xFFFF
+        convertedSize = BA_Unicode_UTF8ToUTF32(target->string, size, (uint32_t*) newBuffer->wideString);
+#else
+        convertedSize = BA_Unicode_UTF8ToUTF16(target->string, size, (uint16_t*) newBuffer->wideString);
+#endif
+    }
+
+    if (convertedSize == BA_UNICODE_ERROR) {
+        BA_STRINGIMPLEMENTATION_FREE(newBuffer);
+        return NULL;
     }
 
+    // The buffer came from calloc, so it's already null terminated
     return newBuffer;
 }
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
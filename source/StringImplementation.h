@@ -15,6 +15,8 @@
 #include "BaconAPI/Internal/Boolean.h"
 #include "BaconAPI/Storage/DynamicArray.h"
 #include "BaconAPI/Storage/DynamicDictionary.h"
+#include "BaconAPI/StringSafeFormat.h"
+#include "BaconAPI/Debugging/Assert.h"
 
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
 typedef struct {
@@ -39,9 +41,21 @@ BA_StringImplementation* BA_StringImplementation_ToUpper(BA_StringImplementation
 BA_StringImplementation* BA_StringImplementation_AppendCharacter(BA_StringImplementation* target, char character, wchar_t wideCharacter);
 BA_StringImplementation* BA_StringImplementation_PrependCharacter(BA_StringImplementation* target, char character, wchar_t wideCharacter);
 BA_StringImplementation* BA_StringImplementation_FormatPremadeList(BA_StringImplementation* target, va_list arguments);
+int BA_StringImplementation_FormatInto(BA_StringImplementation* buffer, size_t capacity, const BA_StringImplementation* format, va_list arguments);
 BA_DynamicArray* BA_StringImplementation_Split(const BA_StringImplementation* target, const BA_StringImplementation* splitBy);
 BA_DynamicArray* BA_StringImplementation_SplitCharacter(const BA_StringImplementation* target, char splitBy, wchar_t wideSplitBy);
 BA_StringImplementation* BA_StringImplementation_FormatSafePremadeList(BA_StringImplementation* target, int amountOfFormatters, va_list arguments);
+
+/**
+ * @note The template only references target, it doesn't copy it
+ */
+BA_Boolean BA_StringImplementation_ParseSafeFormat(BA_StringSafeFormat_Template* compiledTemplate, const BA_StringImplementation* target);
+BA_StringSafeFormat_Template* BA_StringImplementation_CompileSafeFormat(const BA_StringImplementation* target);
+
+/**
+ * @return A raw char*, or wchar_t*, depending on the template
+ */
+void* BA_StringImplementation_ApplySafeFormat(const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, va_list arguments);
 BA_StringImplementation* BA_StringImplementation_CreateEmpty(BA_Boolean isWideString);
 BA_StringImplementation* BA_StringImplementation_Replace(BA_StringImplementation* target, const BA_StringImplementation* what, const BA_StringImplementation* to);
 BA_StringImplementation* BA_StringImplementation_ReplaceCharacter(BA_StringImplementation* target, char what, wchar_t wideWhat, char to, wchar_t wideTo);
@@ -177,17 +191,40 @@ BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_HEADER(name, PrependCharacter,
 BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_FOOTER(name)
 
 #define BA_STRINGIMPLEMENTATION_CREATE_FORMAT(name) \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_HEADER(name, Format, BA_STRINGIMPLEMENTATION_TYPE(name)* target, ...) \
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, Format, BA_STRINGIMPLEMENTATION_TYPE(name)* target, ...) { \
+    BA_STRINGIMPLEMENTATION_CREATE_IMPLEMENTATION_STRING(name, target); \
     va_list arguments;                              \
     va_start(arguments, target);                    \
-    result = BA_StringImplementation_FormatPremadeList(result, arguments); \
+    BA_StringImplementation* result = BA_StringImplementation_FormatPremadeList(&targetImplementation, arguments); \
     va_end(arguments);                              \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_FOOTER(name)
+    if (result == NULL)                             \
+        return NULL;                                \
+    return BA_STRINGIMPLEMENTATION_DEREFERENCE(name, targetImplementation); \
+}
 
 #define BA_STRINGIMPLEMENTATION_CREATE_FORMAT_PREMADE_LIST(name) \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_HEADER(name, FormatPremadeList, BA_STRINGIMPLEMENTATION_TYPE(name)* target, va_list arguments) \
-    result = BA_StringImplementation_FormatPremadeList(result, arguments); \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_FOOTER(name)
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, FormatPremadeList, BA_STRINGIMPLEMENTATION_TYPE(name)* target, va_list arguments) { \
+    BA_STRINGIMPLEMENTATION_CREATE_IMPLEMENTATION_STRING(name, target); \
+    if (BA_StringImplementation_FormatPremadeList(&targetImplementation, arguments) == NULL) \
+        return NULL;                                             \
+    return BA_STRINGIMPLEMENTATION_DEREFERENCE(name, targetImplementation); \
+}
+
+#define BA_STRINGIMPLEMENTATION_CREATE_FORMAT_INTO_PREMADE_LIST(name) \
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(int, name, FormatIntoPremadeList, BA_STRINGIMPLEMENTATION_TYPE(name)* buffer, size_t capacity, const BA_STRINGIMPLEMENTATION_TYPE(name)* format, va_list arguments) { \
+    BA_STRINGIMPLEMENTATION_CREATE_IMPLEMENTATION_STRING(name, buffer); \
+    BA_STRINGIMPLEMENTATION_CREATE_IMPLEMENTATION_STRING(name, format); \
+    return BA_StringImplementation_FormatInto(&bufferImplementation, capacity, &formatImplementation, arguments); \
+}
+
+#define BA_STRINGIMPLEMENTATION_CREATE_FORMAT_INTO(name) \
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(int, name, FormatInto, BA_STRINGIMPLEMENTATION_TYPE(name)* buffer, size_t capacity, const BA_STRINGIMPLEMENTATION_TYPE(name)* format, ...) { \
+    va_list arguments;                                   \
+    va_start(arguments, format);                         \
+    int result = BA_ ## name ## _FormatIntoPremadeList(buffer, capacity, format, arguments); \
+    va_end(arguments);                                   \
+    return result;                                       \
+}
 
 #define BA_STRINGIMPLEMENTATION_CREATE_SPLIT(name) \
 BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_DynamicArray*, name, Split, const BA_STRINGIMPLEMENTATION_TYPE(name)* target, const BA_STRINGIMPLEMENTATION_TYPE(name)* splitBy) { \
@@ -203,17 +240,42 @@ BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_DynamicArray*, name, SplitCharacter,
 }
 
 #define BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE(name) \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_HEADER(name, FormatSafe, BA_STRINGIMPLEMENTATION_TYPE(name)* target, int amountOfFormatters, ...) \
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, FormatSafe, BA_STRINGIMPLEMENTATION_TYPE(name)* target, int amountOfFormatters, ...) { \
     va_list arguments;                                   \
     va_start(arguments, amountOfFormatters);             \
-    result = BA_StringImplementation_FormatSafePremadeList(result, amountOfFormatters, arguments); \
+    BA_STRINGIMPLEMENTATION_TYPE(name)* result = BA_ ## name ## _FormatSafePremadeList(target, amountOfFormatters, arguments); \
     va_end(arguments);                                   \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_FOOTER(name)
+    return result;                                       \
+}
 
 #define BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE_PREMADE_LIST(name) \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_HEADER(name, FormatSafePremadeList, BA_STRINGIMPLEMENTATION_TYPE(name)* target, int amountOfFormatters, va_list arguments) \
-    result = BA_StringImplementation_FormatSafePremadeList(result, amountOfFormatters, arguments); \
-BA_STRINGIMPLEMENTATION_CREATE_BASE_MODIFY_TARGET_FOOTER(name)
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, FormatSafePremadeList, BA_STRINGIMPLEMENTATION_TYPE(name)* target, int amountOfFormatters, va_list arguments) { \
+    BA_STRINGIMPLEMENTATION_CREATE_IMPLEMENTATION_STRING(name, target); \
+    if (BA_StringImplementation_FormatSafePremadeList(&targetImplementation, amountOfFormatters, arguments) == NULL) \
+        return NULL;                                                 \
+    return BA_STRINGIMPLEMENTATION_DEREFERENCE(name, targetImplementation); \
+}
+
+#define BA_STRINGIMPLEMENTATION_CREATE_COMPILE_FORMAT_SAFE(name) \
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_StringSafeFormat_Template*, name, CompileFormatSafe, const BA_STRINGIMPLEMENTATION_TYPE(name)* target) { \
+    BA_STRINGIMPLEMENTATION_CREATE_IMPLEMENTATION_STRING(name, target); \
+    return BA_StringImplementation_CompileSafeFormat(&targetImplementation); \
+}
+
+#define BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE_COMPILED_PREMADE_LIST(name) \
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, FormatSafeCompiledPremadeList, const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, va_list arguments) { \
+    BA_ASSERT(compiledTemplate == NULL || compiledTemplate->isWideString == BA_STRINGIMPLEMENTATION_BOOLEAN(name), "Template was not compiled for this string type\n"); \
+    return (BA_STRINGIMPLEMENTATION_TYPE(name)*) BA_StringImplementation_ApplySafeFormat(compiledTemplate, amountOfFormatters, arguments); \
+}
+
+#define BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE_COMPILED(name) \
+BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, FormatSafeCompiled, const BA_StringSafeFormat_Template* compiledTemplate, int amountOfFormatters, ...) { \
+    va_list arguments;                                   \
+    va_start(arguments, amountOfFormatters);             \
+    BA_STRINGIMPLEMENTATION_TYPE(name)* result = BA_ ## name ## _FormatSafeCompiledPremadeList(compiledTemplate, amountOfFormatters, arguments); \
+    va_end(arguments);                                   \
+    return result;                                       \
+}
 
 #define BA_STRINGIMPLEMENTATION_CREATE_CREATE_EMPTY(name) \
 BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, CreateEmpty, void) { \
@@ -249,6 +311,8 @@ BA_STRINGIMPLEMENTATION_CREATE_BASE_FOOTER(name)
 BA_STRINGIMPLEMENTATION_FUNCTION_HEADER(BA_STRINGIMPLEMENTATION_TYPE(name)*, name, Convert, const BA_STRINGIMPLEMENTATION_OPPOSITE_TYPE(name)* target) { \
     BA_STRINGIMPLEMENTATION_CREATE_OPPOSITE_IMPLEMENTATION_STRING(name, target); \
     BA_StringImplementation* result = BA_StringImplementation_Convert(&targetImplementation); \
+    if (result == NULL)                                \
+        return NULL;                                   \
 BA_STRINGIMPLEMENTATION_CREATE_BASE_FOOTER(name)
 
 #define BA_STRINGIMPLEMENTATION_CREATE(name) \
@@ -266,10 +330,15 @@ BA_STRINGIMPLEMENTATION_CREATE_APPEND_CHARACTER(name) \
 BA_STRINGIMPLEMENTATION_CREATE_PREPEND_CHARACTER(name) \
 BA_STRINGIMPLEMENTATION_CREATE_FORMAT(name)  \
 BA_STRINGIMPLEMENTATION_CREATE_FORMAT_PREMADE_LIST(name) \
+BA_STRINGIMPLEMENTATION_CREATE_FORMAT_INTO_PREMADE_LIST(name) \
+BA_STRINGIMPLEMENTATION_CREATE_FORMAT_INTO(name) \
 BA_STRINGIMPLEMENTATION_CREATE_SPLIT(name)   \
 BA_STRINGIMPLEMENTATION_CREATE_SPLIT_CHARACTER(name) \
 BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE(name) \
 BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE_PREMADE_LIST(name) \
+BA_STRINGIMPLEMENTATION_CREATE_COMPILE_FORMAT_SAFE(name) \
+BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE_COMPILED_PREMADE_LIST(name) \
+BA_STRINGIMPLEMENTATION_CREATE_FORMAT_SAFE_COMPILED(name) \
 BA_STRINGIMPLEMENTATION_CREATE_CREATE_EMPTY(name) \
 BA_STRINGIMPLEMENTATION_CREATE_REPLACE(name) \
 BA_STRINGIMPLEMENTATION_CREATE_REPLACE_CHARACTER(name) \
@@ -0,0 +1,278 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BaconAPI/StringIntern.h"
+#include "BaconAPI/Thread.h"
+#include "BaconAPI/Hash.h"
+#include "BaconAPI/Debugging/Assert.h"
+
+#define BA_STRINGINTERN_BLOCK_SIZE 4096
+#define BA_STRINGINTERN_DEFAULT_TABLE_SIZE 64
+#define BA_STRINGINTERN_ATOM_ARRAY_SIZE 256
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+/**
+ * Sits right before the string, so the string pointer is all we need to get back to it
+ */
+typedef struct {
+    uint64_t hash;
+    size_t length;
+    BA_StringIntern_Atom atom;
+} BA_StringIntern_Entry;
+
+typedef struct BA_StringIntern_Block {
+    struct BA_StringIntern_Block* next;
+    size_t used;
+    size_t size;
+    uint64_t data[]; // uint64_t, so every entry stays aligned
+} BA_StringIntern_Block;
+
+static BA_Thread_Once baStringInternOnce = BA_THREAD_ONCE_INITIALIZER;
+static BA_Thread_Lock baStringInternLock;
+static BA_StringIntern_Entry** baStringInternTable = NULL;
+static size_t baStringInternTableSize = 0;
+static BA_DynamicArray baStringInternAtoms;
+static BA_StringIntern_Block* baStringInternBlocks = NULL;
+
+static void BA_StringIntern_CreateLock(void) {
+    BA_ASSERT(BA_Thread_CreateLock(&baStringInternLock), "Failed to create string intern lock\n");
+}
+
+static BA_StringIntern_Entry** BA_StringIntern_FindSlot(const char* string, size_t length, uint64_t hash) {
+    size_t mask = baStringInternTableSize - 1;
+
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        BA_StringIntern_Entry* entry = baStringInternTable[i];
+
+        if (entry == NULL || (entry->hash == hash && entry->length == length && memcmp(entry + 1, string, length) == 0))
+            return &baStringInternTable[i];
+    }
+}
+
+static BA_Boolean BA_StringIntern_Grow(void) {
+    size_t newSize = baStringInternTableSize * 2;
+    BA_StringIntern_Entry** newTable = calloc(newSize, sizeof(BA_StringIntern_Entry*));
+
+    if (newTable == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    for (int i = 0; i < baStringInternAtoms.used; i++) {
+        BA_StringIntern_Entry* entry = BA_DYNAMICARRAY_GET_ELEMENT(BA_StringIntern_Entry, baStringInternAtoms, i);
+        size_t slot = entry->hash & (newSize - 1);
+
+        while (newTable[slot] != NULL)
+            slot = (slot + 1) & (newSize - 1);
+
+        newTable[slot] = entry;
+    }
+
+    free(baStringInternTable);
+
+    baStringInternTable = newTable;
+    baStringInternTableSize = newSize;
+    return BA_BOOLEAN_TRUE;
+}
+
+static BA_StringIntern_Entry* BA_StringIntern_AllocateEntry(size_t length) {
+    size_t needed = (sizeof(BA_StringIntern_Entry) + length + 1 + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+
+    if (baStringInternBlocks == NULL || baStringInternBlocks->size - baStringInternBlocks->used < needed) {
+        size_t size = needed > BA_STRINGINTERN_BLOCK_SIZE ? needed : BA_STRINGINTERN_BLOCK_SIZE;
+        BA_StringIntern_Block* block = malloc(sizeof(BA_StringIntern_Block) + size);
+
+        if (block == NULL)
+            return NULL;
+
+        block->next = baStringInternBlocks;
+        block->used = 0;
+        block->size = size;
+        baStringInternBlocks = block;
+    }
+
+    BA_StringIntern_Entry* entry = (BA_StringIntern_Entry*) ((char*) baStringInternBlocks->data + baStringInternBlocks->used);
+
+    baStringInternBlocks->used += needed;
+    return entry;
+}
+
+/**
+ * @note Lock has to be held
+ */
+static const char* BA_StringIntern_InternLocked(const char* string, size_t length) {
+    if (baStringInternTable == NULL) {
+        baStringInternTable = calloc(BA_STRINGINTERN_DEFAULT_TABLE_SIZE, sizeof(BA_StringIntern_Entry*));
+
+        if (baStringInternTable == NULL)
+            return NULL;
+
+        if (!BA_DynamicArray_Create(&baStringInternAtoms, BA_STRINGINTERN_ATOM_ARRAY_SIZE)) {
+            free(baStringInternTable);
+
+            baStringInternTable = NULL;
+            return NULL;
+        }
+
+        baStringInternTableSize = BA_STRINGINTERN_DEFAULT_TABLE_SIZE;
+    }
+
+    uint64_t hash = BA_Hash_Bytes(string, length);
+    BA_StringIntern_Entry** slot = BA_StringIntern_FindSlot(string, length, hash);
+
+    if (*slot != NULL)
+        return (const char*) (*slot + 1);
+
+    // Keep the table at most half full, so probes stay short
+    if ((size_t) (baStringInternAtoms.used + 1) * 2 > baStringInternTableSize) {
+        if (!BA_StringIntern_Grow())
+            return NULL;
+
+        slot = BA_StringIntern_FindSlot(string, length, hash);
+    }
+
+    BA_StringIntern_Entry* entry = BA_StringIntern_AllocateEntry(length);
+
+    if (entry == NULL || !BA_DynamicArray_AddElementToLast(&baStringInternAtoms, entry))
+        return NULL;
+
+    char* entryString = (char*) (entry + 1);
+
+    entry->hash = hash;
+    entry->length = length;
+    entry->atom = baStringInternAtoms.used - 1;
+
+    memcpy(entryString, string, length);
+
+    entryString[length] = '\0';
+    *slot = entry;
+    return entryString;
+}
+
+const char* BA_StringIntern_Intern(const char* string) {
+    if (string == NULL)
+        return NULL;
+
+    return BA_StringIntern_InternLength(string, strlen(string));
+}
+
+const char* BA_StringIntern_InternLength(const char* string, size_t length) {
+    if (string == NULL)
+        return NULL;
+
+    BA_Thread_CallOnce(&baStringInternOnce, &BA_StringIntern_CreateLock);
+    BA_Thread_UseLock(&baStringInternLock);
+
+    const char* interned = BA_StringIntern_InternLocked(string, length);
+
+    BA_Thread_Unlock(&baStringInternLock);
+    return interned;
+}
+
+const char* BA_StringIntern_Find(const char* string) {
+    if (string == NULL)
+        return NULL;
+
+    BA_Thread_CallOnce(&baStringInternOnce, &BA_StringIntern_CreateLock);
+    BA_Thread_UseLock(&baStringInternLock);
+
+    const char* interned = NULL;
+
+    if (baStringInternTable != NULL) {
+        size_t length = strlen(string);
+        BA_StringIntern_Entry* entry = *BA_StringIntern_FindSlot(string, length, BA_Hash_Bytes(string, length));
+
+        if (entry != NULL)
+            interned = (const char*) (entry + 1);
+    }
+
+    BA_Thread_Unlock(&baStringInternLock);
+    return interned;
+}
+
+BA_Boolean BA_StringIntern_InternDynamicArray(const BA_DynamicArray* array, const char** output) {
+    BA_Boolean result = BA_BOOLEAN_TRUE;
+
+    BA_Thread_CallOnce(&baStringInternOnce, &BA_StringIntern_CreateLock);
+    BA_Thread_UseLock(&baStringInternLock);
+
+    for (int i = 0; i < array->used; i++) {
+        const char* string = BA_DYNAMICARRAY_GET_ELEMENT_POINTER(const char, array, i);
+
+        output[i] = string != NULL ? BA_StringIntern_InternLocked(string, strlen(string)) : NULL;
+
+        if (string != NULL && output[i] == NULL) {
+            result = BA_BOOLEAN_FALSE;
+            break;
+        }
+    }
+
+    BA_Thread_Unlock(&baStringInternLock);
+    return result;
+}
+
+BA_StringIntern_Atom BA_StringIntern_GetAtom(const char* string) {
+    const char* interned = BA_StringIntern_Intern(string);
+
+    return interned != NULL ? BA_StringIntern_GetAtomFromInterned(interned) : BA_STRINGINTERN_INVALID_ATOM;
+}
+
+const char* BA_StringIntern_GetString(BA_StringIntern_Atom atom) {
+    BA_Thread_CallOnce(&baStringInternOnce, &BA_StringIntern_CreateLock);
+    BA_Thread_UseLock(&baStringInternLock);
+
+    const char* interned = NULL;
+
+    if (baStringInternTable != NULL && atom >= 0 && atom < baStringInternAtoms.used)
+        interned = (const char*) (BA_DYNAMICARRAY_GET_ELEMENT(BA_StringIntern_Entry, baStringInternAtoms, atom) + 1);
+
+    BA_Thread_Unlock(&baStringInternLock);
+    return interned;
+}
+
+BA_StringIntern_Atom BA_StringIntern_GetAtomFromInterned(const char* interned) {
+    return ((const BA_StringIntern_Entry*) interned - 1)->atom;
+}
+
+uint64_t BA_StringIntern_GetHash(const char* interned) {
+    return ((const BA_StringIntern_Entry*) interned - 1)->hash;
+}
+
+size_t BA_StringIntern_GetLength(const char* interned) {
+    return ((const BA_StringIntern_Entry*) interned - 1)->length;
+}
+
+int BA_StringIntern_GetAmount(void) {
+    BA_Thread_CallOnce(&baStringInternOnce, &BA_StringIntern_CreateLock);
+    BA_Thread_UseLock(&baStringInternLock);
+
+    int amount = baStringInternTable != NULL ? baStringInternAtoms.used : 0;
+
+    BA_Thread_Unlock(&baStringInternLock);
+    return amount;
+}
+
+void BA_StringIntern_Free(void) {
+    BA_Thread_CallOnce(&baStringInternOnce, &BA_StringIntern_CreateLock);
+    BA_Thread_UseLock(&baStringInternLock);
+
+    if (baStringInternTable != NULL) {
+        free(baStringInternTable);
+        free(baStringInternAtoms.internalArray);
+
+        baStringInternTable = NULL;
+        baStringInternTableSize = 0;
+    }
+
+    while (baStringInternBlocks != NULL) {
+        BA_StringIntern_Block* next = baStringInternBlocks->next;
+
+        free(baStringInternBlocks);
+
+        baStringInternBlocks = next;
+    }
+
+    BA_Thread_Unlock(&baStringInternLock);
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -6,127 +6,209 @@
 #include <stdlib.h>
 
 #include "BaconAPI/StringManager.h"
-#include "BaconAPI/Storage/DynamicArray.h"
 #include "BaconAPI/WideString.h"
 #include "BaconAPI/String.h"
+#include "BaconAPI/SharedString.h"
 
-#define BA_STRINGMANAGER_CHECK_INITIALIZED() \
-do {                                         \
-    if (!baStringManagerInitialized) {       \
-        baStringManagerInitialized = BA_BOOLEAN_TRUE; \
-        BA_DynamicArray_Create(&baStringManagerArray, 100); \
-    }                                        \
-} while (BA_BOOLEAN_FALSE)
+#define BA_STRINGMANAGER_SLAB_BITS 8
+#define BA_STRINGMANAGER_SLAB_SIZE (1 << BA_STRINGMANAGER_SLAB_BITS)
+#define BA_STRINGMANAGER_SLOT_BITS 24
+#define BA_STRINGMANAGER_SLOT_MASK ((1 << BA_STRINGMANAGER_SLOT_BITS) - 1)
+#define BA_STRINGMANAGER_GENERATION_MASK 0x7F // Whatever is left, so handles stay positive
 
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
 typedef struct {
     union {
         char* string;
         wchar_t* wideString;
+        int nextFree; // Only while it isn't being used, -1 if it's the last one
     };
+    unsigned int generation; // Goes up every time it's deallocated, so old handles stop working
+    BA_Boolean used;
     BA_Boolean isWideString;
+    BA_Boolean isShared;
 } BA_StringManager_Implementation;
 
-static BA_DynamicArray baStringManagerArray;
-static BA_Boolean baStringManagerInitialized = BA_BOOLEAN_FALSE;
+/**
+ * Entries never move once they're made. Slots that get deallocated are reused before anything new is made
+ */
+static BA_StringManager_Implementation** baStringManagerSlabs = NULL;
+static int baStringManagerSlabAmount = 0;
+static int baStringManagerSlotsUsed = 0;
+static int baStringManagerFreeSlot = -1;
+
+static void BA_StringManager_FreeString(BA_StringManager_Implementation* implementation) {
+    if (implementation->isShared)
+        BA_SharedString_Release(implementation->string);
+    else if (implementation->isWideString)
+        free(implementation->wideString);
+    else
+        free(implementation->string);
+}
 
-void* BA_StringManager_Get(int index) {
-    BA_STRINGMANAGER_CHECK_INITIALIZED();
+/**
+ * @return NULL if the handle is invalid, or was deallocated
+ */
+static BA_StringManager_Implementation* BA_StringManager_GetImplementation(int index) {
+    int slot = index & BA_STRINGMANAGER_SLOT_MASK;
 
-    if (baStringManagerArray.used <= index || index < 0)
+    if (index < 0 || slot >= baStringManagerSlotsUsed)
         return NULL;
 
-    BA_StringManager_Implementation* implementation = BA_DYNAMICARRAY_GET_ELEMENT(BA_StringManager_Implementation, baStringManagerArray, index);
+    BA_StringManager_Implementation* implementation = &baStringManagerSlabs[slot >> BA_STRINGMANAGER_SLAB_BITS][slot & (BA_STRINGMANAGER_SLAB_SIZE - 1)];
 
-    if (implementation->isWideString)
-        return implementation->wideString;
+    if (!implementation->used || implementation->generation != (unsigned int) index >> BA_STRINGMANAGER_SLOT_BITS)
+        return NULL;
 
-    return implementation->string;
+    return implementation;
 }
 
-BA_Boolean BA_StringManager_IsWideString(int index) {
-    BA_STRINGMANAGER_CHECK_INITIALIZED();
-    return baStringManagerArray.used > index ? BA_DYNAMICARRAY_GET_ELEMENT(BA_StringManager_Implementation, baStringManagerArray, index)->isWideString : BA_BOOLEAN_FALSE;
+/**
+ * @return -1 if it failed to allocate memory
+ */
+static int BA_StringManager_TakeSlot(void) {
+    if (baStringManagerFreeSlot != -1) {
+        int slot = baStringManagerFreeSlot;
+
+        baStringManagerFreeSlot = baStringManagerSlabs[slot >> BA_STRINGMANAGER_SLAB_BITS][slot & (BA_STRINGMANAGER_SLAB_SIZE - 1)].nextFree;
+        return slot;
+    }
+
+    if (baStringManagerSlotsUsed > BA_STRINGMANAGER_SLOT_MASK)
+        return -1;
+
+    if (baStringManagerSlotsUsed == baStringManagerSlabAmount * BA_STRINGMANAGER_SLAB_SIZE) {
+        BA_StringManager_Implementation** slabs = realloc(baStringManagerSlabs, sizeof(BA_StringManager_Implementation*) * (size_t) (baStringManagerSlabAmount + 1));
+
+        if (slabs == NULL)
+            return -1;
+
+        baStringManagerSlabs = slabs;
+        baStringManagerSlabs[baStringManagerSlabAmount] = malloc(sizeof(BA_StringManager_Implementation) * BA_STRINGMANAGER_SLAB_SIZE);
+
+        if (baStringManagerSlabs[baStringManagerSlabAmount] == NULL)
+            return -1;
+
+        baStringManagerSlabAmount++;
+    }
+
+    int slot = baStringManagerSlotsUsed++;
+
+    baStringManagerSlabs[slot >> BA_STRINGMANAGER_SLAB_BITS][slot & (BA_STRINGMANAGER_SLAB_SIZE - 1)].generation = 0;
+    return slot;
 }
 
-int BA_StringManager_Allocate(const void* originalString, BA_Boolean isWideString) {
-    BA_STRINGMANAGER_CHECK_INITIALIZED();
+static void BA_StringManager_ReturnSlot(int slot) {
+    BA_StringManager_Implementation* implementation = &baStringManagerSlabs[slot >> BA_STRINGMANAGER_SLAB_BITS][slot & (BA_STRINGMANAGER_SLAB_SIZE - 1)];
 
-    BA_StringManager_Implementation* implementation = malloc(sizeof(BA_StringManager_Implementation));
+    implementation->used = BA_BOOLEAN_FALSE;
+    implementation->generation = (implementation->generation + 1) & BA_STRINGMANAGER_GENERATION_MASK;
+    implementation->nextFree = baStringManagerFreeSlot;
+    baStringManagerFreeSlot = slot;
+}
 
-    if (implementation == NULL)
+/**
+ * @param string Already copied, or retained. NULL means it failed to allocate memory
+ */
+static int BA_StringManager_Store(void* string, BA_Boolean isWideString, BA_Boolean isShared) {
+    if (string == NULL)
         return -1;
 
-    if (isWideString)
-        implementation->wideString = BA_WideString_Copy(originalString);
-    else
-        implementation->string = BA_String_Copy(originalString);
+    int slot = BA_StringManager_TakeSlot();
 
+    if (slot == -1) {
+        if (isShared)
+            BA_SharedString_Release(string);
+        else
+            free(string);
+
+        return -1;
+    }
+
+    BA_StringManager_Implementation* implementation = &baStringManagerSlabs[slot >> BA_STRINGMANAGER_SLAB_BITS][slot & (BA_STRINGMANAGER_SLAB_SIZE - 1)];
+
+    implementation->string = string;
+    implementation->used = BA_BOOLEAN_TRUE;
     implementation->isWideString = isWideString;
+    implementation->isShared = isShared;
+    return (int) (implementation->generation << BA_STRINGMANAGER_SLOT_BITS) | slot;
+}
+
+void* BA_StringManager_Get(int index) {
+    BA_StringManager_Implementation* implementation = BA_StringManager_GetImplementation(index);
+
+    if (implementation == NULL)
+        return NULL;
+
+    if (implementation->isWideString)
+        return implementation->wideString;
 
-    BA_DynamicArray_AddElementToLast(&baStringManagerArray, implementation);
-    return baStringManagerArray.used - 1;
+    return implementation->string;
 }
-void BA_StringManager_Deallocate(int index) {
-    BA_STRINGMANAGER_CHECK_INITIALIZED();
 
-    if (baStringManagerArray.used <= index)
-        return;
+BA_Boolean BA_StringManager_IsWideString(int index) {
+    BA_StringManager_Implementation* implementation = BA_StringManager_GetImplementation(index);
 
-    if (index < 0) {
-        for (int i = 0; i < baStringManagerArray.used; i++) {
-            BA_StringManager_Implementation* implementation = BA_DYNAMICARRAY_GET_ELEMENT(BA_StringManager_Implementation, baStringManagerArray, i);
+    return implementation != NULL ? implementation->isWideString : BA_BOOLEAN_FALSE;
+}
+
+int BA_StringManager_Allocate(const void* originalString, BA_Boolean isWideString) {
+    if (isWideString)
+        return BA_StringManager_Store(BA_WideString_Copy(originalString), BA_BOOLEAN_TRUE, BA_BOOLEAN_FALSE);
+
+    return BA_StringManager_Store(BA_String_Copy(originalString), BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+}
+
+int BA_StringManager_AllocateShared(const char* sharedString) {
+    return BA_StringManager_Store((char*) BA_SharedString_Retain(sharedString), BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+}
 
-            if (implementation->isWideString)
-                free(implementation->wideString);
-            else
-                free(implementation->string);
+void BA_StringManager_Deallocate(int index) {
+    if (index < 0) {
+        for (int i = 0; i < baStringManagerSlotsUsed; i++) {
+            BA_StringManager_Implementation* implementation = &baStringManagerSlabs[i >> BA_STRINGMANAGER_SLAB_BITS][i & (BA_STRINGMANAGER_SLAB_SIZE - 1)];
 
-            free(implementation);
+            if (implementation->used)
+                BA_StringManager_FreeString(implementation);
         }
 
-        free(baStringManagerArray.internalArray);
+        for (int i = 0; i < baStringManagerSlabAmount; i++)
+            free(baStringManagerSlabs[i]);
+
+        free(baStringManagerSlabs);
 
-        baStringManagerInitialized = BA_BOOLEAN_FALSE;
+        baStringManagerSlabs = NULL;
+        baStringManagerSlabAmount = 0;
+        baStringManagerSlotsUsed = 0;
+        baStringManagerFreeSlot = -1;
         return;
     }
 
-    BA_StringManager_Implementation* element = BA_DYNAMICARRAY_GET_ELEMENT(BA_StringManager_Implementation, baStringManagerArray, index);
-
-    // FIXME: This line sucks. Removing it will offset the indexes after it, but not removing it will leave gaps in the array.
-    //        Just replacing those gaps isn't a good idea, because some function could still be referencing it. Sad.
-    //        Also, yes, this is another memory leak
-    // TODO: This whole system is crap and flawed. Find a better approach
-    // BA_DynamicArray_RemoveElementAt(&baStringManagerArray, index);
-
-    baStringManagerArray.internalArray[index] = NULL;
+    BA_StringManager_Implementation* implementation = BA_StringManager_GetImplementation(index);
 
-    if (element->isWideString)
-        free(element->wideString);
-    else
-        free(element->string);
+    if (implementation == NULL)
+        return;
 
-    free(element);
+    BA_StringManager_FreeString(implementation);
+    BA_StringManager_ReturnSlot(index & BA_STRINGMANAGER_SLOT_MASK);
 }
 
 void BA_StringManager_Replace(int index, const void* newString, BA_Boolean isWideString) {
-    BA_STRINGMANAGER_CHECK_INITIALIZED();
+    BA_StringManager_Implementation* implementation = BA_StringManager_GetImplementation(index);
 
-    if (baStringManagerArray.used <= index)
+    if (implementation == NULL)
         return;
 
-    BA_StringManager_Implementation* implementation = BA_DYNAMICARRAY_GET_ELEMENT(BA_StringManager_Implementation, baStringManagerArray, index);
+    void* copy = isWideString ? (void*) BA_WideString_Copy(newString) : (void*) BA_String_Copy(newString);
 
-    if (implementation->isWideString)
-        free(implementation->wideString);
-    else
-        free(implementation->string);
+    // Keeps the old string if the new one can't be copied
+    if (copy == NULL)
+        return;
 
-    implementation->isWideString = isWideString;
+    BA_StringManager_FreeString(implementation);
 
-    if (implementation->isWideString)
-        implementation->wideString = BA_WideString_Copy(newString);
-    else
-        implementation->string = BA_String_Copy(newString);
+    implementation->string = copy;
+    implementation->isWideString = isWideString;
+    implementation->isShared = BA_BOOLEAN_FALSE;
 }
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
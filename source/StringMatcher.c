@@ -0,0 +1,419 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "BaconAPI/StringMatcher.h"
+
+// Full transition tables bigger than this use the compressed automaton instead
+#define BA_STRINGMATCHER_DENSE_LIMIT (256 * 1024)
+
+// Bigger edge lists get binary searched
+#define BA_STRINGMATCHER_LINEAR_SEARCH_LIMIT 8
+
+#define BA_STRINGMATCHER_NONE (-1)
+#define BA_STRINGMATCHER_ROOT 0
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+struct BA_StringMatcher {
+    // Bytes that show up in a pattern get their own class, everything else is class zero
+    unsigned char classes[256];
+    int classAmount;
+    int stateAmount;
+    BA_Boolean dense;
+
+    // Dense: stateAmount * classAmount transitions, with failures already followed
+    int* table;
+
+    // Compressed: the root gets a full row, every other state only stores its own edges sorted by class
+    int* rootTable;
+    int* edgeStarts;
+    unsigned char* edgeClasses;
+    int* edgeTargets;
+    int* failures;
+
+    int* outputs; // First pattern ending on a state
+    int* dictionaryLinks; // Closest state on the failure chain that has an output
+    int* nextPatterns; // Duplicate patterns ending on the same state
+    size_t* patternLengths;
+};
+
+typedef struct {
+    int* firstChild;
+    int* nextSibling;
+    unsigned char* nodeClass;
+    int* outputs;
+    int amount;
+    int capacity;
+} BA_StringMatcher_Trie;
+
+static BA_Boolean BA_StringMatcher_AddNode(BA_StringMatcher_Trie* trie, unsigned char nodeClass) {
+    if (trie->amount == trie->capacity) {
+        int capacity = trie->capacity * 2;
+        int* firstChild = realloc(trie->firstChild, capacity * sizeof(int));
+
+        if (firstChild == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        trie->firstChild = firstChild;
+
+        int* nextSibling = realloc(trie->nextSibling, capacity * sizeof(int));
+
+        if (nextSibling == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        trie->nextSibling = nextSibling;
+
+        unsigned char* nodeClasses = realloc(trie->nodeClass, capacity);
+
+        if (nodeClasses == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        trie->nodeClass = nodeClasses;
+
+        int* outputs = realloc(trie->outputs, capacity * sizeof(int));
+
+        if (outputs == NULL)
+            return BA_BOOLEAN_FALSE;
+
+        trie->outputs = outputs;
+        trie->capacity = capacity;
+    }
+
+    trie->firstChild[trie->amount] = BA_STRINGMATCHER_NONE;
+    trie->nextSibling[trie->amount] = BA_STRINGMATCHER_NONE;
+    trie->nodeClass[trie->amount] = nodeClass;
+    trie->outputs[trie->amount] = BA_STRINGMATCHER_NONE;
+    trie->amount++;
+    return BA_BOOLEAN_TRUE;
+}
+
+static void BA_StringMatcher_FreeTrie(BA_StringMatcher_Trie* trie) {
+    free(trie->firstChild);
+    free(trie->nextSibling);
+    free(trie->nodeClass);
+    free(trie->outputs);
+}
+
+static int BA_StringMatcher_FindChild(const BA_StringMatcher_Trie* trie, int node, unsigned char nodeClass) {
+    for (int child = trie->firstChild[node]; child != BA_STRINGMATCHER_NONE; child = trie->nextSibling[child]) {
+        if (trie->nodeClass[child] == nodeClass)
+            return child;
+    }
+
+    return BA_STRINGMATCHER_NONE;
+}
+
+static int BA_StringMatcher_GetEdge(const BA_StringMatcher* matcher, int state, unsigned char stateClass) {
+    int start = matcher->edgeStarts[state];
+    int end = matcher->edgeStarts[state + 1];
+
+    if (end - start <= BA_STRINGMATCHER_LINEAR_SEARCH_LIMIT) {
+        for (int i = start; i < end; i++) {
+            if (matcher->edgeClasses[i] == stateClass)
+                return matcher->edgeTargets[i];
+        }
+
+        return BA_STRINGMATCHER_NONE;
+    }
+
+    while (start < end) {
+        int middle = start + (end - start) / 2;
+
+        if (matcher->edgeClasses[middle] == stateClass)
+            return matcher->edgeTargets[middle];
+
+        if (matcher->edgeClasses[middle] < stateClass)
+            start = middle + 1;
+        else
+            end = middle;
+    }
+
+    return BA_STRINGMATCHER_NONE;
+}
+
+static int BA_StringMatcher_Step(const BA_StringMatcher* matcher, int state, unsigned char stateClass) {
+    if (matcher->dense)
+        return matcher->table[state * matcher->classAmount + stateClass];
+
+    while (state != BA_STRINGMATCHER_ROOT) {
+        int next = BA_StringMatcher_GetEdge(matcher, state, stateClass);
+
+        if (next != BA_STRINGMATCHER_NONE)
+            return next;
+
+        state = matcher->failures[state];
+    }
+
+    return matcher->rootTable[stateClass];
+}
+
+static BA_Boolean BA_StringMatcher_BuildTrie(BA_StringMatcher* matcher, BA_StringMatcher_Trie* trie, const BA_DynamicArray* patterns) {
+    for (int i = 0; i < patterns->used; i++) {
+        const unsigned char* pattern = BA_DYNAMICARRAY_GET_ELEMENT_POINTER(const unsigned char, patterns, i);
+        int node = BA_STRINGMATCHER_ROOT;
+
+        matcher->nextPatterns[i] = BA_STRINGMATCHER_NONE;
+        matcher->patternLengths[i] = 0;
+
+        if (pattern == NULL || pattern[0] == '\0')
+            continue;
+
+        for (; *pattern != '\0'; pattern++) {
+            unsigned char nodeClass = matcher->classes[*pattern];
+            int child = BA_StringMatcher_FindChild(trie, node, nodeClass);
+
+            if (child == BA_STRINGMATCHER_NONE) {
+                if (!BA_StringMatcher_AddNode(trie, nodeClass))
+                    return BA_BOOLEAN_FALSE;
+
+                child = trie->amount - 1;
+                trie->nextSibling[child] = trie->firstChild[node];
+                trie->firstChild[node] = child;
+            }
+
+            node = child;
+            matcher->patternLengths[i]++;
+        }
+
+        matcher->nextPatterns[i] = trie->outputs[node];
+        trie->outputs[node] = i;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+static void BA_StringMatcher_AssignClasses(BA_StringMatcher* matcher, const BA_DynamicArray* patterns, BA_Boolean caseless) {
+    unsigned char keyClasses[256] = {0};
+
+    matcher->classAmount = 1;
+
+    for (int i = 0; i < patterns->used; i++) {
+        const unsigned char* pattern = BA_DYNAMICARRAY_GET_ELEMENT_POINTER(const unsigned char, patterns, i);
+
+        for (; pattern != NULL && *pattern != '\0'; pattern++) {
+            unsigned char key = caseless ? (unsigned char) tolower(*pattern) : *pattern;
+
+            if (keyClasses[key] == 0)
+                keyClasses[key] = (unsigned char) matcher->classAmount++;
+        }
+    }
+
+    for (int i = 0; i < 256; i++)
+        matcher->classes[i] = keyClasses[caseless ? tolower(i) : i];
+}
+
+static BA_Boolean BA_StringMatcher_CreateTrie(BA_StringMatcher_Trie* trie) {
+    trie->amount = 0;
+    trie->capacity = 64;
+    trie->firstChild = malloc(trie->capacity * sizeof(int));
+    trie->nextSibling = malloc(trie->capacity * sizeof(int));
+    trie->nodeClass = malloc(trie->capacity);
+    trie->outputs = malloc(trie->capacity * sizeof(int));
+
+    if (trie->firstChild == NULL || trie->nextSibling == NULL || trie->nodeClass == NULL || trie->outputs == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    return BA_StringMatcher_AddNode(trie, 0);
+}
+
+static BA_Boolean BA_StringMatcher_CreateCompressedEdges(BA_StringMatcher* matcher, const BA_StringMatcher_Trie* trie) {
+    matcher->rootTable = malloc(matcher->classAmount * sizeof(int));
+    matcher->edgeStarts = malloc((matcher->stateAmount + 1) * sizeof(int));
+    matcher->edgeClasses = malloc(matcher->stateAmount);
+    matcher->edgeTargets = malloc(matcher->stateAmount * sizeof(int));
+
+    if (matcher->rootTable == NULL || matcher->edgeStarts == NULL || matcher->edgeClasses == NULL || matcher->edgeTargets == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    // Every state except the root is the target of exactly one edge
+    int edge = 0;
+
+    for (int state = 0; state < matcher->stateAmount; state++) {
+        int start = edge;
+
+        matcher->edgeStarts[state] = start;
+
+        for (int child = trie->firstChild[state]; child != BA_STRINGMATCHER_NONE; child = trie->nextSibling[child]) {
+            int position = edge++;
+
+            // Insertion sort, edge lists are short
+            while (position > start && matcher->edgeClasses[position - 1] > trie->nodeClass[child]) {
+                matcher->edgeClasses[position] = matcher->edgeClasses[position - 1];
+                matcher->edgeTargets[position] = matcher->edgeTargets[position - 1];
+                position--;
+            }
+
+            matcher->edgeClasses[position] = trie->nodeClass[child];
+            matcher->edgeTargets[position] = child;
+        }
+    }
+
+    matcher->edgeStarts[matcher->stateAmount] = edge;
+
+    for (int i = 0; i < matcher->classAmount; i++)
+        matcher->rootTable[i] = BA_STRINGMATCHER_ROOT;
+
+    for (int child = trie->firstChild[BA_STRINGMATCHER_ROOT]; child != BA_STRINGMATCHER_NONE; child = trie->nextSibling[child])
+        matcher->rootTable[trie->nodeClass[child]] = child;
+
+    return BA_BOOLEAN_TRUE;
+}
+
+/**
+ * Links every state to the longest suffix that's also in the trie, and fills in the dense table if we're using one
+ */
+static BA_Boolean BA_StringMatcher_Compile(BA_StringMatcher* matcher, BA_StringMatcher_Trie* trie) {
+    matcher->stateAmount = trie->amount;
+    matcher->dense = (size_t) matcher->stateAmount * matcher->classAmount * sizeof(int) <= BA_STRINGMATCHER_DENSE_LIMIT;
+    matcher->outputs = trie->outputs;
+    trie->outputs = NULL;
+    matcher->failures = malloc(matcher->stateAmount * sizeof(int));
+    matcher->dictionaryLinks = malloc(matcher->stateAmount * sizeof(int));
+
+    if (matcher->failures == NULL || matcher->dictionaryLinks == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    if (matcher->dense) {
+        matcher->table = malloc((size_t) matcher->stateAmount * matcher->classAmount * sizeof(int));
+
+        if (matcher->table == NULL)
+            return BA_BOOLEAN_FALSE;
+    } else if (!BA_StringMatcher_CreateCompressedEdges(matcher, trie)) {
+        return BA_BOOLEAN_FALSE;
+    }
+
+    int* queue = malloc(matcher->stateAmount * sizeof(int));
+    int queueStart = 0;
+    int queueEnd = 0;
+
+    if (queue == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    matcher->failures[BA_STRINGMATCHER_ROOT] = BA_STRINGMATCHER_ROOT;
+    matcher->dictionaryLinks[BA_STRINGMATCHER_ROOT] = BA_STRINGMATCHER_NONE;
+    queue[queueEnd++] = BA_STRINGMATCHER_ROOT;
+
+    // Breadth first, so every failure link points at a state that's already finished
+    while (queueStart < queueEnd) {
+        int state = queue[queueStart++];
+
+        if (matcher->dense) {
+            int* row = &matcher->table[state * matcher->classAmount];
+
+            if (state == BA_STRINGMATCHER_ROOT) {
+                for (int i = 0; i < matcher->classAmount; i++)
+                    row[i] = BA_STRINGMATCHER_ROOT;
+            } else {
+                memcpy(row, &matcher->table[matcher->failures[state] * matcher->classAmount], matcher->classAmount * sizeof(int));
+            }
+        }
+
+        for (int child = trie->firstChild[state]; child != BA_STRINGMATCHER_NONE; child = trie->nextSibling[child]) {
+            int failure = BA_STRINGMATCHER_ROOT;
+
+            if (state != BA_STRINGMATCHER_ROOT)
+                failure = BA_StringMatcher_Step(matcher, matcher->failures[state], trie->nodeClass[child]);
+
+            matcher->failures[child] = failure;
+            matcher->dictionaryLinks[child] = matcher->outputs[failure] != BA_STRINGMATCHER_NONE ? failure : matcher->dictionaryLinks[failure];
+            queue[queueEnd++] = child;
+
+            if (matcher->dense)
+                matcher->table[state * matcher->classAmount + trie->nodeClass[child]] = child;
+        }
+    }
+
+    free(queue);
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_StringMatcher* BA_StringMatcher_Create(const BA_DynamicArray* patterns, BA_Boolean caseless) {
+    BA_StringMatcher* matcher = calloc(1, sizeof(BA_StringMatcher));
+    BA_StringMatcher_Trie trie = {0};
+
+    if (matcher == NULL)
+        return NULL;
+
+    // There are only 256 bytes, and the null terminator can't be in a pattern, so the classes always fit
+    BA_StringMatcher_AssignClasses(matcher, patterns, caseless);
+
+    matcher->nextPatterns = malloc((patterns->used + 1) * sizeof(int));
+    matcher->patternLengths = malloc((patterns->used + 1) * sizeof(size_t));
+
+    BA_Boolean success = matcher->nextPatterns != NULL && matcher->patternLengths != NULL && BA_StringMatcher_CreateTrie(&trie) &&
+                         BA_StringMatcher_BuildTrie(matcher, &trie, patterns) && BA_StringMatcher_Compile(matcher, &trie);
+
+    BA_StringMatcher_FreeTrie(&trie);
+
+    if (!success) {
+        BA_StringMatcher_Free(matcher);
+        return NULL;
+    }
+
+    return matcher;
+}
+
+void BA_StringMatcher_Free(BA_StringMatcher* matcher) {
+    free(matcher->table);
+    free(matcher->rootTable);
+    free(matcher->edgeStarts);
+    free(matcher->edgeClasses);
+    free(matcher->edgeTargets);
+    free(matcher->failures);
+    free(matcher->outputs);
+    free(matcher->dictionaryLinks);
+    free(matcher->nextPatterns);
+    free(matcher->patternLengths);
+    free(matcher);
+}
+
+size_t BA_StringMatcher_Scan(const BA_StringMatcher* matcher, const char* text, BA_StringMatcher_Callback callback, void* userData) {
+    return BA_StringMatcher_ScanLength(matcher, text, strlen(text), callback, userData);
+}
+
+size_t BA_StringMatcher_ScanLength(const BA_StringMatcher* matcher, const char* text, size_t length, BA_StringMatcher_Callback callback, void* userData) {
+    size_t found = 0;
+    int state = BA_STRINGMATCHER_ROOT;
+
+    for (size_t i = 0; i < length; i++) {
+        state = BA_StringMatcher_Step(matcher, state, matcher->classes[(unsigned char) text[i]]);
+
+        int outputState = matcher->outputs[state] != BA_STRINGMATCHER_NONE ? state : matcher->dictionaryLinks[state];
+
+        for (; outputState != BA_STRINGMATCHER_NONE; outputState = matcher->dictionaryLinks[outputState]) {
+            for (int pattern = matcher->outputs[outputState]; pattern != BA_STRINGMATCHER_NONE; pattern = matcher->nextPatterns[pattern]) {
+                BA_StringMatcher_Match match = {i + 1 - matcher->patternLengths[pattern], pattern};
+
+                found++;
+
+                if (callback != NULL && !callback(&match, userData))
+                    return found;
+            }
+        }
+    }
+
+    return found;
+}
+
+static BA_Boolean BA_StringMatcher_StopAtFirst(const BA_StringMatcher_Match* match, void* userData) {
+    if (userData != NULL)
+        *(BA_StringMatcher_Match*) userData = *match;
+
+    return BA_BOOLEAN_FALSE;
+}
+
+BA_Boolean BA_StringMatcher_Contains(const BA_StringMatcher* matcher, const char* text) {
+    return BA_StringMatcher_FindFirst(matcher, text, NULL);
+}
+
+BA_Boolean BA_StringMatcher_FindFirst(const BA_StringMatcher* matcher, const char* text, BA_StringMatcher_Match* match) {
+    return BA_StringMatcher_Scan(matcher, text, &BA_StringMatcher_StopAtFirst, match) != 0;
+}
+
+BA_Boolean BA_StringMatcher_IsDense(const BA_StringMatcher* matcher) {
+    return matcher->dense;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -7,6 +7,8 @@
 #   define _GNU_SOURCE
 #   include <pthread.h>
 #   include <string.h>
+#   include <errno.h>
+#   include <unistd.h>
 #elif BA_OPERATINGSYSTEM_WINDOWS
 #   include <Windows.h>
 
@@ -46,7 +48,7 @@ BA_Boolean BA_Thread_Create(BA_Thread* thread, BA_Thread_Function threadFunction
         return BA_BOOLEAN_FALSE;
 
 #   if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
-    if (pthread_create(thread, NULL, (void* (*)(void*)) threadFunction, &argument) != 0)
+    if (pthread_create(thread, NULL, (void* (*)(void*)) threadFunction, argument) != 0)
         return BA_BOOLEAN_FALSE;
 
     if (name != NULL) {
@@ -59,7 +61,7 @@ BA_Boolean BA_Thread_Create(BA_Thread* thread, BA_Thread_Function threadFunction
 #endif
     }
 #   elif BA_OPERATINGSYSTEM_WINDOWS
-    *thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE) threadFunction, &argument, 0, NULL);
+    *thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE) threadFunction, argument, 0, NULL);
     
     if (*thread == NULL)
         return BA_BOOLEAN_FALSE;
@@ -146,6 +148,71 @@ BA_Boolean BA_Thread_DestroyLock(BA_Thread_Lock* lock) {
 #endif
 }
 
+BA_Boolean BA_Thread_CreateSemaphore(BA_Thread_Semaphore* semaphore, unsigned int value) {
+#if BA_OPERATINGSYSTEM_APPLE
+    *semaphore = dispatch_semaphore_create((long) value);
+    return *semaphore != NULL;
+#elif BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    return sem_init(semaphore, 0, value) == 0;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    *semaphore = CreateSemaphore(NULL, (LONG) value, LONG_MAX, NULL);
+    return *semaphore != NULL;
+#endif
+}
+
+BA_Boolean BA_Thread_WaitSemaphore(BA_Thread_Semaphore* semaphore) {
+#if BA_OPERATINGSYSTEM_APPLE
+    return dispatch_semaphore_wait(*semaphore, DISPATCH_TIME_FOREVER) == 0;
+#elif BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    // Signals can wake us up early
+    while (sem_wait(semaphore) != 0) {
+        if (errno != EINTR)
+            return BA_BOOLEAN_FALSE;
+    }
+
+    return BA_BOOLEAN_TRUE;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    return WaitForSingleObject(*semaphore, INFINITE) == WAIT_OBJECT_0;
+#endif
+}
+
+BA_Boolean BA_Thread_PostSemaphore(BA_Thread_Semaphore* semaphore) {
+#if BA_OPERATINGSYSTEM_APPLE
+    dispatch_semaphore_signal(*semaphore);
+    return BA_BOOLEAN_TRUE;
+#elif BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    return sem_post(semaphore) == 0;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    return ReleaseSemaphore(*semaphore, 1, NULL) != 0;
+#endif
+}
+
+BA_Boolean BA_Thread_DestroySemaphore(BA_Thread_Semaphore* semaphore) {
+#if BA_OPERATINGSYSTEM_APPLE
+    dispatch_release(*semaphore);
+    return BA_BOOLEAN_TRUE;
+#elif BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    return sem_destroy(semaphore) == 0;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    return CloseHandle(*semaphore) != 0;
+#endif
+}
+
+#if BA_OPERATINGSYSTEM_WINDOWS
+static BOOL CALLBACK BA_Thread_CallOnceTrampoline(PINIT_ONCE once, PVOID function, PVOID* context) {
+    ((BA_Thread_OnceFunction) function)();
+    return TRUE;
+}
+#endif
+
+BA_Boolean BA_Thread_CallOnce(BA_Thread_Once* once, BA_Thread_OnceFunction function) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    return pthread_once(once, function) == 0;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    return InitOnceExecuteOnce(once, &BA_Thread_CallOnceTrampoline, (PVOID) function, NULL) != 0;
+#endif
+}
+
 int BA_Thread_GetLimit(void) {
     return baThreadLimit;
 }
@@ -158,6 +225,19 @@ int BA_Thread_GetAmount(void) {
     return baThreadCreated;
 }
 
+int BA_Thread_GetProcessorAmount(void) {
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    long amount = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return amount > 0 ? (int) amount : 1;
+#elif BA_OPERATINGSYSTEM_WINDOWS
+    SYSTEM_INFO information;
+
+    GetSystemInfo(&information);
+    return information.dwNumberOfProcessors > 0 ? (int) information.dwNumberOfProcessors : 1;
+#endif
+}
+
 BA_Boolean BA_Thread_Kill(BA_Thread thread) {
 #ifndef BA_SINGLE_THREADED
     if (BA_Thread_IsSingleThreaded())
@@ -2,6 +2,9 @@
 // Licensed under MIT <https://opensource.org/licenses/MIT>
 
 #include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "BaconAPI/Translations.h"
 #include "BaconAPI/Storage/DynamicDictionary.h"
@@ -9,29 +12,138 @@
 #include "BaconAPI/Configuration.h"
 #include "BaconAPI/StringManager.h"
 #include "BaconAPI/String.h"
+#include "BaconAPI/Logger.h"
+#include "BaconAPI/Hash.h"
+#include "BaconAPI/MappedFile.h"
+#include "BaconAPI/Atomic.h"
+#include "ConfigurationInternal.h"
+
+#define BA_TRANSLATIONS_DEFAULT_TABLE_SIZE 256
+#define BA_TRANSLATIONS_PACK_MAGIC "BACNLNG"
+#define BA_TRANSLATIONS_PACK_VERSION 1
+#define BA_TRANSLATIONS_PACK_BYTE_ORDER 0x01020304
+#define BA_TRANSLATIONS_PACK_EMPTY UINT32_MAX
 
 BA_CPLUSPLUS_SUPPORT_GUARD_START()
+typedef struct {
+    uint64_t hash;
+    size_t length;
+    int id; // From BA_StringManager
+    char key[];
+} BA_Translations_Entry;
+
+/**
+ * Packs are this, the slots, then every value one after another
+ * @note Hashes, and numbers, are stored the way this machine likes them
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    char code[16];
+    uint32_t entryAmount;
+    uint32_t slotAmount;
+    uint64_t textLength;
+    uint64_t checksum; // Everything after the header
+} BA_Translations_PackHeader;
+
+typedef struct {
+    uint64_t hash; // From BA_Translations_HashKey
+    uint32_t value; // Offset into the text, BA_TRANSLATIONS_PACK_EMPTY if nothing is here
+    uint32_t length;
+} BA_Translations_PackSlot;
+
+struct BA_Translations_Pack {
+    BA_MappedFile* file;
+    const BA_Translations_PackHeader* header;
+    const BA_Translations_PackSlot* slots;
+    const char* text;
+};
+
 static const char* baTranslationsLanguageCode = NULL;
+static BA_Translations_Pack* baTranslationsPack = NULL;
 static BA_DynamicArray baTranslationsKeys;
+static BA_Translations_Entry** baTranslationsTable = NULL;
+static size_t baTranslationsTableSize = 0;
 
-const char* BA_Translations_GetLanguageCode(const char* code) {
-    return baTranslationsLanguageCode;
+/**
+ * Only compares hashes. Loading a language makes sure no two keys share one, so the key itself never has to be checked
+ */
+static BA_Translations_Entry** BA_Translations_FindSlot(uint64_t hash) {
+    size_t mask = baTranslationsTableSize - 1;
+
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        BA_Translations_Entry* entry = baTranslationsTable[i];
+
+        if (entry == NULL || entry->hash == hash)
+            return &baTranslationsTable[i];
+    }
 }
 
-int BA_Translations_GetTranslationId(const char* key) {
+static void BA_Translations_Grow(void) {
+    size_t newSize = baTranslationsTableSize * 2;
+    BA_Translations_Entry** newTable = calloc(newSize, sizeof(BA_Translations_Entry*));
+
+    BA_ASSERT(newTable != NULL, "Failed to allocate memory to store translation keys\n");
+
     for (int i = 0; i < baTranslationsKeys.used; i++) {
-        if (!BA_String_Equals(BA_DYNAMICARRAY_GET_ELEMENT(char, baTranslationsKeys, i), key, BA_BOOLEAN_FALSE))
-            continue;
+        BA_Translations_Entry* entry = BA_DYNAMICARRAY_GET_ELEMENT(BA_Translations_Entry, baTranslationsKeys, i);
+        size_t slot = entry->hash & (newSize - 1);
+
+        while (newTable[slot] != NULL)
+            slot = (slot + 1) & (newSize - 1);
 
-        return i;
+        newTable[slot] = entry;
     }
 
-    return -1;
+    free(baTranslationsTable);
+
+    baTranslationsTable = newTable;
+    baTranslationsTableSize = newSize;
+}
+
+const char* BA_Translations_GetLanguageCode(const char* code) {
+    const BA_Translations_Pack* pack = BA_ATOMIC_LOAD_POINTER(&baTranslationsPack);
+
+    return pack != NULL ? pack->header->code : baTranslationsLanguageCode;
+}
+
+uint64_t BA_Translations_HashKey(const char* key, size_t length) {
+    uint64_t hash = BA_TRANSLATIONS_HASH_OFFSET;
+
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ (unsigned char) key[i]) * BA_TRANSLATIONS_HASH_PRIME;
+
+    return hash;
+}
+
+int BA_Translations_GetTranslationId(const char* key) {
+    if (baTranslationsTable == NULL)
+        return -1;
+
+    size_t length = strlen(key);
+    BA_Translations_Entry* entry = *BA_Translations_FindSlot(BA_Translations_HashKey(key, length));
+
+    // Keys that were never loaded could still have the same hash as one that was
+    return entry != NULL && entry->length == length && memcmp(entry->key, key, length) == 0 ? entry->id : -1;
+}
+
+int BA_Translations_GetTranslationIdFromHash(uint64_t hash) {
+    if (baTranslationsTable == NULL)
+        return -1;
+
+    BA_Translations_Entry* entry = *BA_Translations_FindSlot(hash);
+
+    return entry != NULL ? entry->id : -1;
 }
 
 void BA_Translations_LoadLanguage(const char* code, const char* buffer) {
-    if (baTranslationsLanguageCode == NULL)
-        BA_ASSERT(BA_DynamicArray_Create(&baTranslationsKeys, 100), "Failed to allocate memory to store translation keys\n");
+    if (baTranslationsTable == NULL) {
+        baTranslationsTable = calloc(BA_TRANSLATIONS_DEFAULT_TABLE_SIZE, sizeof(BA_Translations_Entry*));
+        baTranslationsTableSize = BA_TRANSLATIONS_DEFAULT_TABLE_SIZE;
+
+        BA_ASSERT(baTranslationsTable != NULL && BA_DynamicArray_Create(&baTranslationsKeys, 100), "Failed to allocate memory to store translation keys\n");
+    }
 
     baTranslationsLanguageCode = code;
 
@@ -39,48 +151,260 @@ void BA_Translations_LoadLanguage(const char* code, const char* buffer) {
 
     BA_ASSERT(parsedConfiguration != NULL, "Failed to allocate memory for parsed language\n");
 
-    // OPTIMIZE: There has to be a better way to do this
-    // FIXME: If a key doesn't exist in the new language, then nothing will happen to it. That's a memory leak. Sad
-    // FIXME: Actually, it's two memory leaks, since the value doesn't get deleted either
+    // FIXME: If a key doesn't exist in the new language, then it keeps the old language's value
     for (int i = 0; i < parsedConfiguration->keys.used; i++) {
         char* key = BA_DYNAMICARRAY_GET_ELEMENT(char, parsedConfiguration->keys, i);
         char* value = BA_DYNAMICARRAY_GET_ELEMENT(char, parsedConfiguration->values, i);
+        size_t length = strlen(key);
+        uint64_t hash = BA_Translations_HashKey(key, length);
+        BA_Translations_Entry** slot = BA_Translations_FindSlot(hash);
+
+        if (*slot != NULL && ((*slot)->length != length || memcmp((*slot)->key, key, length) != 0)) {
+            BA_LOGGER_ERROR("Translation key \"%s\" has the same hash as \"%s\", skipping it\n", key, (*slot)->key);
+            continue;
+        }
 
-        {
-            BA_Boolean replaced = BA_BOOLEAN_FALSE;
+        // Keys that showed up before, even earlier in this language, keep their ID. The last value wins
+        if (*slot != NULL) {
+            BA_StringManager_Replace((*slot)->id, value, BA_BOOLEAN_FALSE);
+            continue;
+        }
 
-            for (int j = 0; j < baTranslationsKeys.used; j++) {
-                char* key2 = BA_DYNAMICARRAY_GET_ELEMENT(char, baTranslationsKeys, j);
+        // Keep the table at most half full, so probes stay short
+        if ((size_t) (baTranslationsKeys.used + 1) * 2 > baTranslationsTableSize) {
+            BA_Translations_Grow();
 
-                if (!BA_String_Equals(key2, key, BA_BOOLEAN_FALSE))
-                    continue;
+            slot = BA_Translations_FindSlot(hash);
+        }
 
-                replaced = BA_BOOLEAN_TRUE;
+        BA_Translations_Entry* entry = malloc(sizeof(BA_Translations_Entry) + length + 1);
 
-                BA_StringManager_Replace(j, value, BA_BOOLEAN_FALSE);
-                free(key);
-                free(value);
-                break;
-            }
+        BA_ASSERT(entry != NULL, "Failed to allocate memory to store translation keys\n");
+
+        entry->hash = hash;
+        entry->length = length;
+        entry->id = BA_StringManager_Allocate(value, BA_BOOLEAN_FALSE);
 
-            if (replaced)
+        memcpy(entry->key, key, length + 1);
+        BA_DynamicArray_AddElementToLast(&baTranslationsKeys, entry);
+
+        *slot = entry;
+    }
+
+    BA_Configuration_Free(parsedConfiguration);
+}
+
+const char* BA_Translations_Get(const char* key) {
+    return BA_Translations_GetFromHash(BA_Translations_HashKey(key, strlen(key)));
+}
+
+const char* BA_Translations_GetFromHash(uint64_t hash) {
+    const BA_Translations_Pack* pack = BA_ATOMIC_LOAD_POINTER(&baTranslationsPack);
+
+    if (pack == NULL)
+        return BA_StringManager_Get(BA_Translations_GetTranslationIdFromHash(hash));
+
+    size_t mask = pack->header->slotAmount - 1;
+
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        const BA_Translations_PackSlot* slot = &pack->slots[i];
+
+        if (slot->value == BA_TRANSLATIONS_PACK_EMPTY)
+            return NULL;
+
+        if (slot->hash == hash)
+            return pack->text + slot->value;
+    }
+}
+
+BA_Boolean BA_Translations_CompilePack(const char* code, const char* buffer, const char* packPath) {
+    if (strlen(code) >= sizeof(((BA_Translations_PackHeader*) NULL)->code))
+        return BA_BOOLEAN_FALSE;
+
+    BA_DynamicDictionary* parsedConfiguration = BA_Configuration_Parse(buffer);
+
+    if (parsedConfiguration == NULL)
+        return BA_BOOLEAN_FALSE;
+
+    size_t slotAmount = 16;
+
+    while (slotAmount < (size_t) parsedConfiguration->keys.used * 2)
+        slotAmount *= 2;
+
+    // Which key each slot ended up with, so duplicates, and hashes two keys share, can be found
+    int* keyIndexes = malloc(sizeof(int) * slotAmount);
+    uint64_t* hashes = malloc(sizeof(uint64_t) * slotAmount);
+    int entryAmount = 0;
+    size_t textLength = 0;
+
+    if (keyIndexes == NULL || hashes == NULL) {
+        free(keyIndexes);
+        free(hashes);
+        BA_Configuration_Free(parsedConfiguration);
+        return BA_BOOLEAN_FALSE;
+    }
+
+    for (size_t i = 0; i < slotAmount; i++)
+        keyIndexes[i] = -1;
+
+    for (int i = 0; i < parsedConfiguration->keys.used; i++) {
+        const char* key = parsedConfiguration->keys.internalArray[i];
+        uint64_t hash = BA_Translations_HashKey(key, strlen(key));
+        size_t slot = hash & (slotAmount - 1);
+
+        while (keyIndexes[slot] != -1 && hashes[slot] != hash)
+            slot = (slot + 1) & (slotAmount - 1);
+
+        if (keyIndexes[slot] != -1 && strcmp(parsedConfiguration->keys.internalArray[keyIndexes[slot]], key) != 0) {
+            BA_LOGGER_ERROR("Translation key \"%s\" has the same hash as \"%s\", skipping it\n", key, (const char*) parsedConfiguration->keys.internalArray[keyIndexes[slot]]);
+            continue;
+        }
+
+        // Same as loading it, the last value wins
+        if (keyIndexes[slot] == -1)
+            entryAmount++;
+        else
+            textLength -= strlen(parsedConfiguration->values.internalArray[keyIndexes[slot]]) + 1;
+
+        keyIndexes[slot] = i;
+        hashes[slot] = hash;
+        textLength += strlen(parsedConfiguration->values.internalArray[i]) + 1;
+    }
+
+    size_t textOffset = sizeof(BA_Translations_PackHeader) + slotAmount * sizeof(BA_Translations_PackSlot);
+    char* pack = textLength < UINT32_MAX ? calloc(1, textOffset + textLength) : NULL;
+    BA_Boolean written = BA_BOOLEAN_FALSE;
+
+    if (pack != NULL) {
+        BA_Translations_PackHeader* header = (BA_Translations_PackHeader*) pack;
+        BA_Translations_PackSlot* slots = (BA_Translations_PackSlot*) (pack + sizeof(BA_Translations_PackHeader));
+        size_t textUsed = 0;
+
+        for (size_t i = 0; i < slotAmount; i++) {
+            if (keyIndexes[i] == -1) {
+                slots[i].value = BA_TRANSLATIONS_PACK_EMPTY;
                 continue;
+            }
+
+            const char* value = parsedConfiguration->values.internalArray[keyIndexes[i]];
+            size_t length = strlen(value);
+
+            slots[i].hash = hashes[i];
+            slots[i].value = (uint32_t) textUsed;
+            slots[i].length = (uint32_t) length;
+
+            memcpy(pack + textOffset + textUsed, value, length + 1);
+
+            textUsed += length + 1;
         }
 
-        BA_StringManager_Allocate(value, BA_BOOLEAN_FALSE);
-        BA_DynamicArray_AddElementToLast(&baTranslationsKeys, key);
-        free(value);
+        memcpy(header->magic, BA_TRANSLATIONS_PACK_MAGIC, sizeof(header->magic));
+        strcpy(header->code, code);
+
+        header->version = BA_TRANSLATIONS_PACK_VERSION;
+        header->byteOrder = BA_TRANSLATIONS_PACK_BYTE_ORDER;
+        header->entryAmount = (uint32_t) entryAmount;
+        header->slotAmount = (uint32_t) slotAmount;
+        header->textLength = textLength;
+        header->checksum = BA_Hash_Bytes(pack + sizeof(BA_Translations_PackHeader), textOffset + textLength - sizeof(BA_Translations_PackHeader));
+        written = BA_Configuration_WriteFile(packPath, pack, textOffset + textLength);
     }
 
-    free(parsedConfiguration->keys.internalArray);
-    free(parsedConfiguration->values.internalArray);
-    free(parsedConfiguration);
+    free(pack);
+    free(keyIndexes);
+    free(hashes);
+    BA_Configuration_Free(parsedConfiguration);
+    return written;
+}
+
+BA_Translations_Pack* BA_Translations_OpenPack(const char* packPath) {
+    BA_MappedFile* file = BA_MappedFile_Open(packPath, BA_MAPPEDFILE_ACCESS_RANDOM);
+
+    if (file == NULL)
+        return NULL;
+
+    const char* data = BA_MappedFile_GetData(file);
+    size_t length = BA_MappedFile_GetLength(file);
+    const BA_Translations_PackHeader* header = (const BA_Translations_PackHeader*) data;
+    size_t textOffset = length + 1;
+
+    // Measured against what's left, so a huge slot amount can't wrap around into something that looks right
+    if (length >= sizeof(BA_Translations_PackHeader) && header->slotAmount <= (length - sizeof(BA_Translations_PackHeader)) / sizeof(BA_Translations_PackSlot))
+        textOffset = sizeof(BA_Translations_PackHeader) + (size_t) header->slotAmount * sizeof(BA_Translations_PackSlot);
+
+    if (length < sizeof(BA_Translations_PackHeader) || memcmp(header->magic, BA_TRANSLATIONS_PACK_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != BA_TRANSLATIONS_PACK_VERSION || header->byteOrder != BA_TRANSLATIONS_PACK_BYTE_ORDER ||
+        header->slotAmount < 16 || (header->slotAmount & (header->slotAmount - 1)) != 0 || header->entryAmount > header->slotAmount / 2 ||
+        memchr(header->code, '\0', sizeof(header->code)) == NULL ||
+        textOffset > length || header->textLength != length - textOffset ||
+        (header->textLength != 0 && data[length - 1] != '\0') ||
+        header->checksum != BA_Hash_Bytes(data + sizeof(BA_Translations_PackHeader), length - sizeof(BA_Translations_PackHeader))) {
+        BA_LOGGER_TRACE("Language pack is invalid\n");
+        BA_MappedFile_Close(file);
+        return NULL;
+    }
+
+    const BA_Translations_PackSlot* slots = (const BA_Translations_PackSlot*) (data + sizeof(BA_Translations_PackHeader));
+    uint32_t usedSlots = 0;
+    BA_Boolean valid = BA_BOOLEAN_TRUE;
+
+    for (uint32_t i = 0; i < header->slotAmount; i++) {
+        if (slots[i].value == BA_TRANSLATIONS_PACK_EMPTY)
+            continue;
+
+        usedSlots++;
+        valid = valid && (uint64_t) slots[i].value + slots[i].length < header->textLength;
+    }
+
+    // Lookups stop at the first empty slot, so some have to be empty
+    if (!valid || usedSlots != header->entryAmount) {
+        BA_LOGGER_TRACE("Language pack is invalid\n");
+        BA_MappedFile_Close(file);
+        return NULL;
+    }
+
+    BA_Translations_Pack* pack = malloc(sizeof(BA_Translations_Pack));
+
+    if (pack == NULL) {
+        BA_MappedFile_Close(file);
+        return NULL;
+    }
+
+    pack->file = file;
+    pack->header = header;
+    pack->slots = slots;
+    pack->text = data + textOffset;
+    return pack;
+}
+
+void BA_Translations_ClosePack(BA_Translations_Pack* pack) {
+    BA_ATOMIC_COMPARE_EXCHANGE_POINTER(&baTranslationsPack, pack, NULL);
+    BA_MappedFile_Close(pack->file);
+    free(pack);
+}
+
+void BA_Translations_UsePack(BA_Translations_Pack* pack) {
+    BA_ATOMIC_STORE_POINTER(&baTranslationsPack, pack);
 }
 
 void BA_Translations_Destroy(void) {
+    // The pack belongs to whoever opened it, and might already be closed
+    BA_ATOMIC_STORE_POINTER(&baTranslationsPack, NULL);
+
+    if (baTranslationsTable == NULL)
+        return;
+
     for (int i = 0; i < baTranslationsKeys.used; i++)
         free(baTranslationsKeys.internalArray[i]);
 
     free(baTranslationsKeys.internalArray);
+    free(baTranslationsTable);
+
+    baTranslationsKeys.internalArray = NULL;
+    baTranslationsKeys.used = 0;
+    baTranslationsKeys.size = 0;
+    baTranslationsTable = NULL;
+    baTranslationsTableSize = 0;
+    baTranslationsLanguageCode = NULL;
 }
 BA_CPLUSPLUS_SUPPORT_GUARD_END()
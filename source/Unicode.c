@@ -0,0 +1,481 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+
+#include "BaconAPI/Unicode.h"
+#include "BaconAPI/Internal/Compiler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define BA_UNICODE_SSE2 1
+#   include <emmintrin.h>
+#else
+#   define BA_UNICODE_SSE2 0
+#endif
+
+// AVX2 is picked at runtime, so it needs a compiler that lets us target it per function
+#if BA_UNICODE_SSE2 && (BA_COMPILER_GCC || BA_COMPILER_CLANG)
+#   define BA_UNICODE_AVX2 1
+#   include <immintrin.h>
+#else
+#   define BA_UNICODE_AVX2 0
+#endif
+
+#define BA_UNICODE_IS_SURROGATE(codePoint) ((codePoint) >= 0xD800 && (codePoint) <= 0xDFFF)
+#define BA_UNICODE_IS_HIGH_SURROGATE(codeUnit) ((codeUnit) >= 0xD800 && (codeUnit) <= 0xDBFF)
+#define BA_UNICODE_IS_LOW_SURROGATE(codeUnit) ((codeUnit) >= 0xDC00 && (codeUnit) <= 0xDFFF)
+
+BA_CPLUSPLUS_SUPPORT_GUARD_START()
+#if BA_UNICODE_AVX2
+static int baUnicodeHasAVX2 = -1;
+
+static BA_Boolean BA_Unicode_HasAVX2(void) {
+    if (baUnicodeHasAVX2 == -1) {
+        __builtin_cpu_init();
+
+        baUnicodeHasAVX2 = __builtin_cpu_supports("avx2") != 0;
+    }
+
+    return baUnicodeHasAVX2;
+}
+
+__attribute__((target("avx2")))
+static size_t BA_Unicode_CountASCIIAVX2(const unsigned char* input, size_t length) {
+    size_t position = 0;
+
+    for (; length - position >= 32; position += 32) {
+        if (_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*) (input + position))) != 0)
+            break;
+    }
+
+    return position;
+}
+
+__attribute__((target("avx2")))
+static size_t BA_Unicode_WidenASCIIToUTF32AVX2(const unsigned char* input, size_t length, uint32_t* output) {
+    size_t position = 0;
+
+    for (; length - position >= 32; position += 32) {
+        if (_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*) (input + position))) != 0)
+            break;
+
+        for (int i = 0; i < 32; i += 8)
+            _mm256_storeu_si256((__m256i*) (output + position + i), _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) (input + position + i))));
+    }
+
+    return position;
+}
+#endif
+
+// The kernels below only handle whole blocks of ASCII, and return how many units they got through. Whatever is left
+// goes through the scalar code
+
+static size_t BA_Unicode_CountASCII(const unsigned char* input, size_t length) {
+    size_t position = 0;
+
+#if BA_UNICODE_AVX2
+    if (BA_Unicode_HasAVX2())
+        position = BA_Unicode_CountASCIIAVX2(input, length);
+#endif
+
+#if BA_UNICODE_SSE2
+    for (; length - position >= 16; position += 16) {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (input + position))) != 0)
+            break;
+    }
+#else
+    for (; length - position >= 8; position += 8) {
+        uint64_t block;
+
+        memcpy(&block, input + position, sizeof(uint64_t));
+
+        if ((block & 0x8080808080808080u) != 0)
+            break;
+    }
+#endif
+
+    return position;
+}
+
+static size_t BA_Unicode_WidenASCIIToUTF32(const unsigned char* input, size_t length, uint32_t* output) {
+    size_t position = 0;
+
+#if BA_UNICODE_AVX2
+    if (BA_Unicode_HasAVX2())
+        position = BA_Unicode_WidenASCIIToUTF32AVX2(input, length, output);
+#endif
+
+#if BA_UNICODE_SSE2
+    __m128i zero = _mm_setzero_si128();
+
+    for (; length - position >= 16; position += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*) (input + position));
+
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+        _mm_storeu_si128((__m128i*) (output + position), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i*) (output + position + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i*) (output + position + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i*) (output + position + 12), _mm_unpackhi_epi16(high, zero));
+    }
+#else
+    (void) input;
+    (void) length;
+    (void) output;
+#endif
+
+    return position;
+}
+
+static size_t BA_Unicode_WidenASCIIToUTF16(const unsigned char* input, size_t length, uint16_t* output) {
+    size_t position = 0;
+
+#if BA_UNICODE_SSE2
+    __m128i zero = _mm_setzero_si128();
+
+    for (; length - position >= 16; position += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*) (input + position));
+
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        _mm_storeu_si128((__m128i*) (output + position), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*) (output + position + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+#else
+    (void) input;
+    (void) length;
+    (void) output;
+#endif
+
+    return position;
+}
+
+static size_t BA_Unicode_NarrowASCIIFromUTF32(const uint32_t* input, size_t length, unsigned char* output) {
+    size_t position = 0;
+
+#if BA_UNICODE_SSE2
+    __m128i notASCII = _mm_set1_epi32(~0x7F);
+    __m128i zero = _mm_setzero_si128();
+
+    for (; length - position >= 16; position += 16) {
+        __m128i first = _mm_loadu_si128((const __m128i*) (input + position));
+        __m128i second = _mm_loadu_si128((const __m128i*) (input + position + 4));
+        __m128i third = _mm_loadu_si128((const __m128i*) (input + position + 8));
+        __m128i fourth = _mm_loadu_si128((const __m128i*) (input + position + 12));
+        __m128i combined = _mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(combined, notASCII), zero)) != 0xFFFF)
+            break;
+
+        _mm_storeu_si128((__m128i*) (output + position), _mm_packus_epi16(_mm_packs_epi32(first, second), _mm_packs_epi32(third, fourth)));
+    }
+#else
+    (void) input;
+    (void) length;
+    (void) output;
+#endif
+
+    return position;
+}
+
+static size_t BA_Unicode_NarrowASCIIFromUTF16(const uint16_t* input, size_t length, unsigned char* output) {
+    size_t position = 0;
+
+#if BA_UNICODE_SSE2
+    __m128i notASCII = _mm_set1_epi16(~0x7F);
+    __m128i zero = _mm_setzero_si128();
+
+    for (; length - position >= 16; position += 16) {
+        __m128i low = _mm_loadu_si128((const __m128i*) (input + position));
+        __m128i high = _mm_loadu_si128((const __m128i*) (input + position + 8));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(low, high), notASCII), zero)) != 0xFFFF)
+            break;
+
+        _mm_storeu_si128((__m128i*) (output + position), _mm_packus_epi16(low, high));
+    }
+#else
+    (void) input;
+    (void) length;
+    (void) output;
+#endif
+
+    return position;
+}
+
+/**
+ * Decodes one character starting at position, and moves position past it
+ */
+static BA_Boolean BA_Unicode_DecodeUTF8(const unsigned char* input, size_t length, size_t* position, uint32_t* codePoint) {
+    unsigned char lead = input[*position];
+    unsigned char minimum = 0x80;
+    unsigned char maximum = 0xBF;
+    size_t needed;
+
+    if (lead < 0x80) {
+        *codePoint = lead;
+        (*position)++;
+        return BA_BOOLEAN_TRUE;
+    }
+
+    if (lead < 0xC2) // Continuation byte, or an overlong two byte sequence
+        return BA_BOOLEAN_FALSE;
+
+    if (lead < 0xE0) {
+        needed = 1;
+        *codePoint = lead & 0x1F;
+    } else if (lead < 0xF0) {
+        needed = 2;
+        *codePoint = lead & 0x0F;
+
+        if (lead == 0xE0)
+            minimum = 0xA0; // Overlong
+        else if (lead == 0xED)
+            maximum = 0x9F; // Surrogates
+    } else if (lead < 0xF5) {
+        needed = 3;
+        *codePoint = lead & 0x07;
+
+        if (lead == 0xF0)
+            minimum = 0x90; // Overlong
+        else if (lead == 0xF4)
+            maximum = 0x8F; // Above U+10FFFF
+    } else
+        return BA_BOOLEAN_FALSE;
+
+    if (length - *position - 1 < needed)
+        return BA_BOOLEAN_FALSE;
+
+    for (size_t i = 1; i <= needed; i++) {
+        unsigned char continuation = input[*position + i];
+
+        if (continuation < minimum || continuation > maximum)
+            return BA_BOOLEAN_FALSE;
+
+        *codePoint = (*codePoint << 6) | (continuation & 0x3F);
+        minimum = 0x80;
+        maximum = 0xBF;
+    }
+
+    *position += needed + 1;
+    return BA_BOOLEAN_TRUE;
+}
+
+/**
+ * @return How many bytes it wrote
+ * @note codePoint has to be valid
+ */
+static size_t BA_Unicode_EncodeUTF8(uint32_t codePoint, unsigned char* output) {
+    if (codePoint < 0x80) {
+        output[0] = (unsigned char) codePoint;
+        return 1;
+    }
+
+    if (codePoint < 0x800) {
+        output[0] = (unsigned char) (0xC0 | (codePoint >> 6));
+        output[1] = (unsigned char) (0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+
+    if (codePoint < 0x10000) {
+        output[0] = (unsigned char) (0xE0 | (codePoint >> 12));
+        output[1] = (unsigned char) (0x80 | ((codePoint >> 6) & 0x3F));
+        output[2] = (unsigned char) (0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+
+    output[0] = (unsigned char) (0xF0 | (codePoint >> 18));
+    output[1] = (unsigned char) (0x80 | ((codePoint >> 12) & 0x3F));
+    output[2] = (unsigned char) (0x80 | ((codePoint >> 6) & 0x3F));
+    output[3] = (unsigned char) (0x80 | (codePoint & 0x3F));
+    return 4;
+}
+
+static BA_Boolean BA_Unicode_DecodeUTF16(const uint16_t* input, size_t length, size_t* position, uint32_t* codePoint) {
+    uint16_t first = input[*position];
+
+    if (!BA_UNICODE_IS_SURROGATE(first)) {
+        *codePoint = first;
+        (*position)++;
+        return BA_BOOLEAN_TRUE;
+    }
+
+    if (!BA_UNICODE_IS_HIGH_SURROGATE(first) || *position + 1 >= length || !BA_UNICODE_IS_LOW_SURROGATE(input[*position + 1]))
+        return BA_BOOLEAN_FALSE;
+
+    *codePoint = 0x10000 + (((uint32_t) first - 0xD800) << 10) + ((uint32_t) input[*position + 1] - 0xDC00);
+    *position += 2;
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_Unicode_IsASCII(const char* string, size_t length) {
+    const unsigned char* input = (const unsigned char*) string;
+
+    for (size_t position = BA_Unicode_CountASCII(input, length); position < length; position++) {
+        if (input[position] >= 0x80)
+            return BA_BOOLEAN_FALSE;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+BA_Boolean BA_Unicode_ValidateUTF8(const char* string, size_t length) {
+    const unsigned char* input = (const unsigned char*) string;
+    size_t position = 0;
+
+    while (position < length) {
+        position += BA_Unicode_CountASCII(input + position, length - position);
+
+        if (position >= length)
+            break;
+
+        uint32_t codePoint;
+
+        if (!BA_Unicode_DecodeUTF8(input, length, &position, &codePoint))
+            return BA_BOOLEAN_FALSE;
+    }
+
+    return BA_BOOLEAN_TRUE;
+}
+
+size_t BA_Unicode_UTF8ToUTF32(const char* input, size_t length, uint32_t* output) {
+    const unsigned char* bytes = (const unsigned char*) input;
+    size_t position = 0;
+    size_t written = 0;
+
+    while (position < length) {
+        size_t converted = BA_Unicode_WidenASCIIToUTF32(bytes + position, length - position, output + written);
+
+        position += converted;
+        written += converted;
+
+        if (position >= length)
+            break;
+
+        if (!BA_Unicode_DecodeUTF8(bytes, length, &position, &output[written]))
+            return BA_UNICODE_ERROR;
+
+        written++;
+    }
+
+    return written;
+}
+
+size_t BA_Unicode_UTF8ToUTF16(const char* input, size_t length, uint16_t* output) {
+    const unsigned char* bytes = (const unsigned char*) input;
+    size_t position = 0;
+    size_t written = 0;
+
+    while (position < length) {
+        size_t converted = BA_Unicode_WidenASCIIToUTF16(bytes + position, length - position, output + written);
+
+        position += converted;
+        written += converted;
+
+        if (position >= length)
+            break;
+
+        uint32_t codePoint;
+
+        if (!BA_Unicode_DecodeUTF8(bytes, length, &position, &codePoint))
+            return BA_UNICODE_ERROR;
+
+        if (codePoint < 0x10000) {
+            output[written++] = (uint16_t) codePoint;
+            continue;
+        }
+
+        codePoint -= 0x10000;
+        output[written++] = (uint16_t) (0xD800 + (codePoint >> 10));
+        output[written++] = (uint16_t) (0xDC00 + (codePoint & 0x3FF));
+    }
+
+    return written;
+}
+
+size_t BA_Unicode_UTF32ToUTF8(const uint32_t* input, size_t length, char* output) {
+    unsigned char* bytes = (unsigned char*) output;
+    size_t position = 0;
+    size_t written = 0;
+
+    while (position < length) {
+        size_t converted = BA_Unicode_NarrowASCIIFromUTF32(input + position, length - position, bytes + written);
+
+        position += converted;
+        written += converted;
+
+        if (position >= length)
+            break;
+
+        uint32_t codePoint = input[position++];
+
+        if (codePoint > 0x10FFFF || BA_UNICODE_IS_SURROGATE(codePoint))
+            return BA_UNICODE_ERROR;
+
+        written += BA_Unicode_EncodeUTF8(codePoint, bytes + written);
+    }
+
+    return written;
+}
+
+size_t BA_Unicode_UTF16ToUTF8(const uint16_t* input, size_t length, char* output) {
+    unsigned char* bytes = (unsigned char*) output;
+    size_t position = 0;
+    size_t written = 0;
+
+    while (position < length) {
+        size_t converted = BA_Unicode_NarrowASCIIFromUTF16(input + position, length - position, bytes + written);
+
+        position += converted;
+        written += converted;
+
+        if (position >= length)
+            break;
+
+        uint32_t codePoint;
+
+        if (!BA_Unicode_DecodeUTF16(input, length, &position, &codePoint))
+            return BA_UNICODE_ERROR;
+
+        written += BA_Unicode_EncodeUTF8(codePoint, bytes + written);
+    }
+
+    return written;
+}
+
+size_t BA_Unicode_GetUTF8LengthFromUTF32(const uint32_t* input, size_t length) {
+    size_t total = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        uint32_t codePoint = input[i];
+
+        if (codePoint > 0x10FFFF || BA_UNICODE_IS_SURROGATE(codePoint))
+            return BA_UNICODE_ERROR;
+
+        total += 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000);
+    }
+
+    return total;
+}
+
+size_t BA_Unicode_GetUTF8LengthFromUTF16(const uint16_t* input, size_t length) {
+    size_t total = 0;
+    size_t position = 0;
+
+    while (position < length) {
+        uint32_t codePoint;
+
+        if (!BA_Unicode_DecodeUTF16(input, length, &position, &codePoint))
+            return BA_UNICODE_ERROR;
+
+        total += 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000);
+    }
+
+    return total;
+}
+BA_CPLUSPLUS_SUPPORT_GUARD_END()
@@ -0,0 +1,49 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+#include <stdlib.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/CompactString.h>
+
+void Test(void) {
+    BA_CompactString* string = BA_CompactString_Create(L"Hello, World!");
+
+    BA_ASSERT(string != NULL, "Failed to create compact string\n");
+    BA_ASSERT(BA_CompactString_GetWidth(string) == 1, "ASCII should be stored with one byte per character\n");
+    BA_ASSERT(BA_CompactString_GetLength(string) == 13, "Wrong length\n");
+    BA_ASSERT(BA_CompactString_GetCharacter(string, 7) == L'W', "Wrong character\n");
+    BA_ASSERT(BA_CompactString_Equals(string, L"Hello, World!") && !BA_CompactString_Equals(string, L"Hello"), "Equals failed\n");
+    BA_ASSERT(BA_CompactString_StartsWith(string, L"Hello") && BA_CompactString_EndsWith(string, L"World!"), "StartsWith/EndsWith failed\n");
+    BA_ASSERT(BA_CompactString_Find(string, L"World") == 7 && !BA_CompactString_Contains(string, L"Moon"), "Find failed\n");
+    BA_ASSERT(!BA_CompactString_Contains(string, L"\x20AC"), "Found a character that can't be stored\n");
+    BA_ASSERT(BA_CompactString_GetMemoryUsage(string) < sizeof(BA_CompactString) + 13 * sizeof(wchar_t) || sizeof(wchar_t) == 1, "Compact string isn't compact\n");
+
+    BA_ASSERT(BA_CompactString_Append(&string, L" \x20AC"), "Failed to append\n");
+    BA_ASSERT(BA_CompactString_GetWidth(string) == 2, "Storage should have widened\n");
+    BA_ASSERT(BA_CompactString_Equals(string, L"Hello, World! \x20AC") && BA_CompactString_EndsWith(string, L"\x20AC"), "Widening lost characters\n");
+
+    {
+        wchar_t* wideString = BA_CompactString_ToWideString(string);
+        char* narrowString = BA_CompactString_ToString(string);
+
+        BA_ASSERT(wideString != NULL && wcscmp(wideString, L"Hello, World! \x20AC") == 0, "Failed to materialize wide string\n");
+        BA_ASSERT(narrowString != NULL && strcmp(narrowString, "Hello, World! \xE2\x82\xAC") == 0, "Failed to convert to UTF-8\n");
+        free(wideString);
+        free(narrowString);
+    }
+
+    {
+        BA_CompactString* fromString = BA_CompactString_CreateFromString("Hello, World! \xE2\x82\xAC");
+        BA_CompactString* latin = BA_CompactString_CreateFromString("caf\xC3\xA9");
+
+        BA_ASSERT(fromString != NULL && BA_CompactString_EqualsCompact(fromString, string), "UTF-8 string didn't match\n");
+        BA_ASSERT(latin != NULL && BA_CompactString_GetWidth(latin) == 1 && BA_CompactString_Equals(latin, L"caf\xE9"), "Latin-1 characters should fit in one byte\n");
+        BA_ASSERT(BA_CompactString_CreateFromString("\xC0\x80") == NULL, "Accepted invalid UTF-8\n");
+        BA_CompactString_Free(fromString);
+        BA_CompactString_Free(latin);
+    }
+
+    BA_CompactString_Free(string);
+}
@@ -4,7 +4,70 @@
 #include <BaconAPI/Configuration.h>
 #include <BaconAPI/Debugging/Assert.h>
 #include <BaconAPI/String.h>
+#include <BaconAPI/Hash.h>
 #include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    int64_t integer;
+    uint64_t timeout;
+    uint64_t cacheSize;
+    double ratio;
+    BA_Boolean verbose;
+    const char* name;
+    int64_t missing;
+} Settings;
+
+// Where things are in a compiled image
+#define IMAGE_HEADER_SIZE 56
+#define IMAGE_ENTRY_AMOUNT_OFFSET 16
+#define IMAGE_SLOT_AMOUNT_OFFSET 20
+#define IMAGE_TEXT_LENGTH_OFFSET 40
+#define IMAGE_CHECKSUM_OFFSET 48
+#define IMAGE_SLOT_SIZE 8
+#define IMAGE_SLOT_INDEX_OFFSET 4
+
+static const BA_Configuration_Field settingsFields[] = {
+    BA_CONFIGURATION_FIELD(Settings, integer, "integer", BA_CONFIGURATION_TYPE_INTEGER),
+    BA_CONFIGURATION_FIELD(Settings, timeout, "timeout", BA_CONFIGURATION_TYPE_DURATION),
+    BA_CONFIGURATION_FIELD(Settings, cacheSize, "cache.size", BA_CONFIGURATION_TYPE_SIZE),
+    BA_CONFIGURATION_FIELD(Settings, ratio, "ratio", BA_CONFIGURATION_TYPE_DOUBLE),
+    BA_CONFIGURATION_FIELD(Settings, verbose, "verbose", BA_CONFIGURATION_TYPE_BOOLEAN),
+    BA_CONFIGURATION_FIELD(Settings, name, "name", BA_CONFIGURATION_TYPE_STRING),
+    BA_CONFIGURATION_FIELD(Settings, missing, "missing", BA_CONFIGURATION_TYPE_INTEGER)
+};
+
+static unsigned char* ReadImage(const char* path, size_t* length) {
+    FILE* file = fopen(path, "rb");
+    unsigned char* data;
+
+    BA_ASSERT(file != NULL, "Failed to open compiled configuration\n");
+    fseek(file, 0, SEEK_END);
+
+    *length = (size_t) ftell(file);
+    data = malloc(*length);
+
+    BA_ASSERT(data != NULL, "Failed to allocate memory for compiled configuration\n");
+    fseek(file, 0, SEEK_SET);
+    BA_ASSERT(fread(data, 1, *length, file) == *length, "Failed to read compiled configuration\n");
+    fclose(file);
+    return data;
+}
+
+/**
+ * Fixes the checksum first, so only the validation can catch what was changed
+ */
+static void WriteImage(const char* path, unsigned char* data, size_t length) {
+    uint64_t checksum = BA_Hash_Bytes(data + IMAGE_HEADER_SIZE, length - IMAGE_HEADER_SIZE);
+    FILE* file = fopen(path, "wb");
+
+    memcpy(data + IMAGE_CHECKSUM_OFFSET, &checksum, sizeof(checksum));
+    BA_ASSERT(file != NULL, "Failed to open compiled configuration\n");
+    BA_ASSERT(fwrite(data, 1, length, file) == length, "Failed to write compiled configuration\n");
+    fclose(file);
+    free(data);
+}
 
 void Test(void) {
     {
@@ -17,13 +80,9 @@ void Test(void) {
 
             for (int i = 0; i < dictionary->keys.used; i++) {
                 BA_LOGGER_INFO("(%i) %s=%s\n", i, BA_DYNAMICARRAY_GET_ELEMENT(char, dictionary->keys, i), BA_DYNAMICARRAY_GET_ELEMENT(char, dictionary->values, i));
-                free(dictionary->keys.internalArray[i]);
-                free(dictionary->values.internalArray[i]);
             }
 
-            free(dictionary->keys.internalArray);
-            free(dictionary->values.internalArray);
-            free(dictionary);
+            BA_Configuration_Free(dictionary);
             fclose(file);
         } else
             BA_LOGGER_WARN("Failed to open test file, skipping BA_Configuration_ParseFromFile\n");
@@ -43,5 +102,327 @@ void Test(void) {
     BA_ASSERT(BA_String_Equals(BA_Configuration_GetValue(dictionary, "test.goodbye", BA_BOOLEAN_FALSE), "Goodbye, Moon!", BA_BOOLEAN_FALSE), "Value does not match expected\n");
     BA_ASSERT(BA_Configuration_GetValue(dictionary, "test.hello2", BA_BOOLEAN_FALSE) == NULL, "Found commented out key\n");
     BA_ASSERT(BA_Configuration_GetValue(dictionary, "test.goodbye2", BA_BOOLEAN_FALSE) == NULL, "Found non-existent key\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "TEST.Hello", BA_BOOLEAN_FALSE) == -1, "Caseless lookup when it shouldn't be\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "TEST.Hello", BA_BOOLEAN_TRUE) == 0, "Caseless index did not match expected\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "test.GOODBYE", BA_BOOLEAN_TRUE) == 1, "Caseless index did not match expected\n");
+    BA_Configuration_Free(dictionary);
+
+    dictionary = BA_Configuration_Parse("equals=a=b==c\r\n"
+                                        "empty=\n"
+                                        "noEquals\n"
+                                        "=noKey\n"
+                                        "last=line");
+
+    BA_ASSERT(dictionary != NULL, "Failed to allocate memory for a dictionary\n");
+    BA_ASSERT(dictionary->keys.used == 4, "Dictionary used does not match expected\n");
+    BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "equals", BA_BOOLEAN_FALSE), "a=b==c") == 0, "Equals signs in the value were lost\n");
+    BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "empty", BA_BOOLEAN_FALSE), "") == 0, "Empty value does not match expected\n");
+    BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "noEquals", BA_BOOLEAN_FALSE), "") == 0, "Key without a value does not match expected\n");
+    BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "last", BA_BOOLEAN_FALSE), "line") == 0, "Last line does not match expected\n");
+    BA_Configuration_Free(dictionary);
+
+    {
+        FILE* file = tmpfile();
+
+        BA_ASSERT(file != NULL, "Failed to create a temporary file\n");
+        fputs("// Comment\nfile.key=File value\nfile.url=https://example.com/?a=b\n", file);
+        rewind(file);
+
+        dictionary = BA_Configuration_ParseFromFile(file);
+
+        BA_ASSERT(dictionary != NULL, "Failed to parse configuration file\n");
+        BA_ASSERT(dictionary->keys.used == 2, "Dictionary used does not match expected\n");
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "file.key", BA_BOOLEAN_FALSE), "File value") == 0, "Value does not match expected\n");
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "FILE.URL", BA_BOOLEAN_TRUE), "https://example.com/?a=b") == 0, "Value does not match expected\n");
+        BA_Configuration_Free(dictionary);
+
+        // Whatever is before the file pointer gets skipped
+        char header[32];
+
+        rewind(file);
+        BA_ASSERT(fgets(header, sizeof(header), file) != NULL && fgets(header, sizeof(header), file) != NULL, "Failed to skip the header\n");
+
+        dictionary = BA_Configuration_ParseFromFile(file);
+
+        BA_ASSERT(dictionary != NULL, "Failed to parse configuration file\n");
+        BA_ASSERT(dictionary->keys.used == 1, "Dictionary used does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetValue(dictionary, "file.key", BA_BOOLEAN_FALSE) == NULL, "Skipped key was parsed\n");
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "file.url", BA_BOOLEAN_FALSE), "https://example.com/?a=b") == 0, "Value does not match expected\n");
+        BA_ASSERT(fgetc(file) == EOF, "File pointer was not left at the end\n");
+        BA_Configuration_Free(dictionary);
+        fclose(file);
+    }
+
+    {
+        int64_t integer;
+        uint64_t unsignedInteger;
+        double number;
+        BA_Boolean boolean;
+        Settings settings = {0};
+
+        settings.missing = 42;
+        dictionary = BA_Configuration_Parse("integer=-1234\n"
+                                            "unsigned=0x10\n"
+                                            "leading=010\n"
+                                            "notoctal=08\n"
+                                            "hex=-0X1f\n"
+                                            "negative=-1\n"
+                                            "ratio=0.25\n"
+                                            "verbose=Yes\n"
+                                            "off= off \n"
+                                            "timeout=1.5s\n"
+                                            "hours=2h\n"
+                                            "cache.size=64 MiB\n"
+                                            "huge=100000000T\n"
+                                            "name=Bacon\n"
+                                            "broken=12abc");
+
+        BA_ASSERT(dictionary != NULL, "Failed to allocate memory for a dictionary\n");
+        BA_ASSERT(BA_Configuration_GetInteger(dictionary, "integer", BA_BOOLEAN_FALSE, &integer) && integer == -1234, "Integer does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetInteger(dictionary, "integer", BA_BOOLEAN_FALSE, &integer) && integer == -1234, "Cached integer does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetUnsigned(dictionary, "unsigned", BA_BOOLEAN_FALSE, &unsignedInteger) && unsignedInteger == 16, "Unsigned does not match expected\n");
+        BA_ASSERT(!BA_Configuration_GetUnsigned(dictionary, "negative", BA_BOOLEAN_FALSE, &unsignedInteger), "Negative number was unsigned\n");
+        BA_ASSERT(BA_Configuration_GetInteger(dictionary, "leading", BA_BOOLEAN_FALSE, &integer) && integer == 10, "Leading zero was octal\n");
+        BA_ASSERT(BA_Configuration_GetUnsigned(dictionary, "notoctal", BA_BOOLEAN_FALSE, &unsignedInteger) && unsignedInteger == 8, "Leading zero was octal\n");
+        BA_ASSERT(BA_Configuration_GetInteger(dictionary, "hex", BA_BOOLEAN_FALSE, &integer) && integer == -31, "Hexadecimal integer does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetDouble(dictionary, "ratio", BA_BOOLEAN_FALSE, &number) && number == 0.25, "Double does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetBoolean(dictionary, "verbose", BA_BOOLEAN_FALSE, &boolean) && boolean, "Boolean does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetBoolean(dictionary, "off", BA_BOOLEAN_FALSE, &boolean) && !boolean, "Boolean does not match expected\n");
+        BA_ASSERT(!BA_Configuration_GetBoolean(dictionary, "ratio", BA_BOOLEAN_FALSE, &boolean), "Number was a boolean\n");
+        BA_ASSERT(BA_Configuration_GetDuration(dictionary, "timeout", BA_BOOLEAN_FALSE, &unsignedInteger) && unsignedInteger == 1500, "Duration does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetDuration(dictionary, "hours", BA_BOOLEAN_FALSE, &unsignedInteger) && unsignedInteger == 7200000, "Duration does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetSize(dictionary, "cache.size", BA_BOOLEAN_FALSE, &unsignedInteger) && unsignedInteger == 64 * 1024 * 1024, "Size does not match expected\n");
+        BA_ASSERT(!BA_Configuration_GetSize(dictionary, "huge", BA_BOOLEAN_FALSE, &unsignedInteger), "Size that's too big was accepted\n");
+        BA_ASSERT(!BA_Configuration_GetSize(dictionary, "name", BA_BOOLEAN_FALSE, &unsignedInteger), "String was a size\n");
+
+        integer = 7;
+
+        BA_ASSERT(!BA_Configuration_GetInteger(dictionary, "broken", BA_BOOLEAN_FALSE, &integer) && integer == 7, "Invalid integer changed the result\n");
+        BA_ASSERT(!BA_Configuration_GetInteger(dictionary, "broken", BA_BOOLEAN_FALSE, &integer), "Cached invalid integer was valid\n");
+        BA_ASSERT(!BA_Configuration_GetInteger(dictionary, "nothing", BA_BOOLEAN_FALSE, &integer), "Got a missing key\n");
+
+        // Asking for a different type than what got cached still works
+        BA_ASSERT(BA_Configuration_GetDouble(dictionary, "integer", BA_BOOLEAN_FALSE, &number) && number == -1234, "Double does not match expected\n");
+        BA_ASSERT(BA_Configuration_Bind(dictionary, settingsFields, sizeof(settingsFields) / sizeof(settingsFields[0]), &settings, BA_BOOLEAN_FALSE) == 6, "Bound the wrong amount of fields\n");
+        BA_ASSERT(settings.integer == -1234 && settings.timeout == 1500 && settings.cacheSize == 64 * 1024 * 1024, "Bound fields do not match expected\n");
+        BA_ASSERT(settings.ratio == 0.25 && settings.verbose && strcmp(settings.name, "Bacon") == 0, "Bound fields do not match expected\n");
+        BA_ASSERT(settings.missing == 42, "Missing field was changed\n");
+
+        // Each type gets cached on its own
+        BA_ASSERT(!BA_Configuration_GetBoolean(dictionary, "integer", BA_BOOLEAN_FALSE, &boolean), "Integer was a boolean\n");
+        BA_ASSERT(!BA_Configuration_GetBoolean(dictionary, "integer", BA_BOOLEAN_FALSE, &boolean), "Cached integer was a boolean\n");
+        BA_ASSERT(BA_Configuration_GetInteger(dictionary, "integer", BA_BOOLEAN_FALSE, &integer) && integer == -1234, "Integer does not match expected\n");
+
+        // Replaced values don't come from the cache
+        BA_DynamicArray_ReplaceElementAt(&dictionary->values, (unsigned int) BA_Configuration_GetIndex(dictionary, "integer", BA_BOOLEAN_FALSE), BA_String_Copy("5678"));
+        BA_ASSERT(BA_Configuration_GetInteger(dictionary, "integer", BA_BOOLEAN_FALSE, &integer) && integer == 5678, "Replaced integer came from the cache\n");
+        BA_Configuration_Free(dictionary);
+    }
+
+    {
+        FILE* file = fopen("ConfigurationTest.settings", "w");
+        int64_t integer;
+
+        BA_ASSERT(file != NULL, "Failed to create configuration file\n");
+        fputs("compiled.name=Bacon\ncompiled.number=12\ncompiled.name=Duplicate\n", file);
+        fclose(file);
+        remove("ConfigurationTest.settings.compiled");
+        BA_ASSERT(BA_Configuration_LoadCompiled("ConfigurationTest.settings.compiled", "ConfigurationTest.settings") == NULL, "Loaded a missing image\n");
+
+        dictionary = BA_Configuration_ParseFromFileCached("ConfigurationTest.settings", "ConfigurationTest.settings.compiled");
+
+        BA_ASSERT(dictionary != NULL, "Failed to parse configuration file\n");
+        BA_Configuration_Free(dictionary);
+
+        dictionary = BA_Configuration_LoadCompiled("ConfigurationTest.settings.compiled", "ConfigurationTest.settings");
+
+        BA_ASSERT(dictionary != NULL, "Failed to load compiled configuration\n");
+        BA_ASSERT(dictionary->keys.used == 3, "Dictionary used does not match expected\n");
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "compiled.name", BA_BOOLEAN_FALSE), "Bacon") == 0, "Compiled value does not match expected\n");
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "COMPILED.NAME", BA_BOOLEAN_TRUE), "Bacon") == 0, "Compiled caseless value does not match expected\n");
+        BA_ASSERT(BA_Configuration_GetValue(dictionary, "compiled.missing", BA_BOOLEAN_FALSE) == NULL, "Found non-existent key\n");
+        BA_ASSERT(BA_Configuration_GetInteger(dictionary, "compiled.number", BA_BOOLEAN_FALSE, &integer) && integer == 12, "Compiled integer does not match expected\n");
+        BA_DynamicDictionary_AddElementToLast(dictionary, BA_String_Copy("Added"), BA_String_Copy("Value"));
+        BA_Configuration_Free(dictionary);
+
+        // Changing the source makes the image out of date
+        file = fopen("ConfigurationTest.settings", "w");
+
+        BA_ASSERT(file != NULL, "Failed to create configuration file\n");
+        fputs("compiled.name=Changed\n", file);
+        fclose(file);
+        BA_ASSERT(BA_Configuration_LoadCompiled("ConfigurationTest.settings.compiled", "ConfigurationTest.settings") == NULL, "Loaded an out of date image\n");
+
+        dictionary = BA_Configuration_ParseFromFileCached("ConfigurationTest.settings", "ConfigurationTest.settings.compiled");
+
+        BA_ASSERT(dictionary != NULL && strcmp(BA_Configuration_GetValue(dictionary, "compiled.name", BA_BOOLEAN_FALSE), "Changed") == 0, "Out of date image was used\n");
+        BA_Configuration_Free(dictionary);
+
+        dictionary = BA_Configuration_LoadCompiled("ConfigurationTest.settings.compiled", NULL);
+
+        BA_ASSERT(dictionary != NULL && strcmp(BA_Configuration_GetValue(dictionary, "compiled.name", BA_BOOLEAN_FALSE), "Changed") == 0, "Image was not rebuilt\n");
+        BA_Configuration_Free(dictionary);
+
+        // Damaged images get caught by the checksum
+        file = fopen("ConfigurationTest.settings.compiled", "r+b");
+
+        BA_ASSERT(file != NULL, "Failed to open compiled configuration\n");
+        fseek(file, -3, SEEK_END);
+        fputc('X', file);
+        fclose(file);
+        BA_ASSERT(BA_Configuration_LoadCompiled("ConfigurationTest.settings.compiled", NULL) == NULL, "Loaded a damaged image\n");
+
+        // Images with a correct checksum still get their header, and slots, checked
+        for (int damage = 0; damage < 4; damage++) {
+            size_t length;
+            unsigned char* data;
+            uint32_t entryAmount;
+
+            dictionary = BA_Configuration_ParseFromFileCached("ConfigurationTest.settings", "ConfigurationTest.settings.compiled");
+
+            BA_ASSERT(dictionary != NULL, "Failed to parse configuration file\n");
+            BA_Configuration_Free(dictionary);
+
+            data = ReadImage("ConfigurationTest.settings.compiled", &length);
+
+            memcpy(&entryAmount, data + IMAGE_ENTRY_AMOUNT_OFFSET, sizeof(entryAmount));
+
+            unsigned char* slots = data + IMAGE_HEADER_SIZE + entryAmount * IMAGE_SLOT_SIZE;
+            size_t slotsLength = length - (size_t) (slots - data) - strlen("compiled.name=Changed") - 1;
+
+            if (damage == 0) {
+                entryAmount = 0x80000000;
+
+                memcpy(data + IMAGE_ENTRY_AMOUNT_OFFSET, &entryAmount, sizeof(entryAmount));
+            } else if (damage == 3) {
+                // Way more entries than the image has, with a text length that wraps around to the right size
+                uint32_t slotAmount = 1 << 21;
+                uint64_t textLength = (uint64_t) length - (IMAGE_HEADER_SIZE + ((uint64_t) 1 << 20) * IMAGE_SLOT_SIZE + (uint64_t) slotAmount * 2 * IMAGE_SLOT_SIZE);
+
+                entryAmount = 1 << 20;
+
+                memcpy(data + IMAGE_ENTRY_AMOUNT_OFFSET, &entryAmount, sizeof(entryAmount));
+                memcpy(data + IMAGE_SLOT_AMOUNT_OFFSET, &slotAmount, sizeof(slotAmount));
+                memcpy(data + IMAGE_TEXT_LENGTH_OFFSET, &textLength, sizeof(textLength));
+            } else {
+                for (size_t i = 0; i < slotsLength; i += IMAGE_SLOT_SIZE) {
+                    int index;
+
+                    memcpy(&index, slots + i + IMAGE_SLOT_INDEX_OFFSET, sizeof(index));
+
+                    // Either points past the entries, or leaves no empty slots
+                    if (damage == 1 && index != -1)
+                        index = 5;
+                    else if (damage == 2)
+                        index = 0;
+
+                    memcpy(slots + i + IMAGE_SLOT_INDEX_OFFSET, &index, sizeof(index));
+                }
+            }
+
+            WriteImage("ConfigurationTest.settings.compiled", data, length);
+            BA_ASSERT(BA_Configuration_LoadCompiled("ConfigurationTest.settings.compiled", NULL) == NULL, "Loaded an image with damage %i\n", damage);
+        }
+        remove("ConfigurationTest.settings.compiled");
+        remove("ConfigurationTest.settings");
+    }
+
+    dictionary = BA_Configuration_Parse("duplicate=First\n"
+                                        "Duplicate=Second\n"
+                                        "duplicate=Third");
+
+    BA_ASSERT(dictionary != NULL, "Failed to allocate memory for a dictionary\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "duplicate", BA_BOOLEAN_FALSE) == 0, "Duplicate key did not give the first one\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "Duplicate", BA_BOOLEAN_FALSE) == 1, "Exact lookup did not match expected\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "DUPLICATE", BA_BOOLEAN_TRUE) == 0, "Caseless duplicate key did not give the first one\n");
+    BA_Configuration_Free(dictionary);
+
+    // Changes that leave the amount of keys alone still stop the index from being used
+    dictionary = BA_Configuration_Parse("first=1\n"
+                                        "second=2");
+
+    BA_ASSERT(dictionary != NULL, "Failed to allocate memory for a dictionary\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "second", BA_BOOLEAN_FALSE) == 1, "Index does not match expected\n");
+    BA_DynamicDictionary_RemoveLastElement(dictionary);
+    BA_DynamicDictionary_AddElementToLast(dictionary, BA_String_Copy("third"), BA_String_Copy("3"));
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "third", BA_BOOLEAN_FALSE) == 1, "Swapped key was not found\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "second", BA_BOOLEAN_FALSE) == -1, "Removed key was found\n");
+    BA_DynamicArray_ReplaceElementAt(&dictionary->keys, 0, BA_String_Copy("replaced"));
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "replaced", BA_BOOLEAN_FALSE) == 0, "Replaced key was not found\n");
+    BA_ASSERT(BA_Configuration_GetIndex(dictionary, "first", BA_BOOLEAN_FALSE) == -1, "Replaced key was found\n");
+    BA_Configuration_Free(dictionary);
+
+    {
+        char* data = malloc(1000 * 32);
+        size_t length = 0;
+
+        BA_ASSERT(data != NULL, "Failed to allocate memory for configuration data\n");
+
+        for (int i = 0; i < 1000; i++)
+            length += (size_t) sprintf(data + length, "Key%i=%i\n", i, i * 2);
+
+        dictionary = BA_Configuration_Parse(data);
+
+        free(data);
+        BA_ASSERT(dictionary != NULL, "Failed to allocate memory for a dictionary\n");
+        BA_ASSERT(dictionary->keys.used == 1000, "Dictionary used does not match expected\n");
+
+        for (int i = 0; i < 1000; i++) {
+            char key[16];
+
+            sprintf(key, "key%i", i);
+            BA_ASSERT(BA_Configuration_GetIndex(dictionary, key, BA_BOOLEAN_TRUE) == i, "Caseless index did not match expected\n");
+            BA_ASSERT(BA_Configuration_GetIndex(dictionary, key, BA_BOOLEAN_FALSE) == -1, "Caseless lookup when it shouldn't be\n");
+            key[0] = 'K';
+            BA_ASSERT(BA_Configuration_GetIndex(dictionary, key, BA_BOOLEAN_FALSE) == i, "Index did not match expected\n");
+        }
+
+        // Changing the keys makes it stop trusting the index
+        BA_DynamicDictionary_AddElementToLast(dictionary, BA_String_Copy("Added"), BA_String_Copy("Value"));
+        BA_ASSERT(BA_Configuration_GetIndex(dictionary, "added", BA_BOOLEAN_TRUE) == 1000, "Added key was not found\n");
+        BA_ASSERT(BA_Configuration_GetIndex(dictionary, "Key999", BA_BOOLEAN_FALSE) == 999, "Index did not match expected\n");
+        BA_Configuration_Free(dictionary);
+    }
+
+    {
+        char* data = malloc(100000 * 32);
+        size_t length = 0;
+        BA_DynamicDictionary* parallelDictionary;
+
+        BA_ASSERT(data != NULL, "Failed to allocate memory for configuration data\n");
+
+        // Big enough to be split into chunks, with duplicates spread between all of them
+        for (int i = 0; i < 100000; i++) {
+            if (i % 7 == 0)
+                length += (size_t) sprintf(data + length, "Shared=%i\r\n", i);
+            else if (i % 11 == 0)
+                length += (size_t) sprintf(data + length, "// Comment %i\n", i);
+            else
+                length += (size_t) sprintf(data + length, "Key%i=%i=%i\n", i, i, i * 2);
+        }
+
+        dictionary = BA_Configuration_Parse(data);
+        parallelDictionary = BA_Configuration_ParseParallel(data, 4);
+
+        free(data);
+        BA_ASSERT(dictionary != NULL && parallelDictionary != NULL, "Failed to allocate memory for a dictionary\n");
+        BA_ASSERT(parallelDictionary->keys.used == dictionary->keys.used, "Parallel dictionary used does not match expected\n");
+
+        for (int i = 0; i < dictionary->keys.used; i++) {
+            BA_ASSERT(strcmp(parallelDictionary->keys.internalArray[i], dictionary->keys.internalArray[i]) == 0, "Parallel key does not match expected\n");
+            BA_ASSERT(strcmp(parallelDictionary->values.internalArray[i], dictionary->values.internalArray[i]) == 0, "Parallel value does not match expected\n");
+        }
+
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(parallelDictionary, "Shared", BA_BOOLEAN_FALSE), "0") == 0, "Duplicate key did not give the first one\n");
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(parallelDictionary, "key99998", BA_BOOLEAN_TRUE), "99998=199996") == 0, "Caseless value did not match expected\n");
+        BA_ASSERT(BA_Configuration_GetIndex(parallelDictionary, "Key12345", BA_BOOLEAN_FALSE) == BA_Configuration_GetIndex(dictionary, "Key12345", BA_BOOLEAN_FALSE), "Parallel index does not match expected\n");
+        BA_Configuration_Free(parallelDictionary);
+        BA_Configuration_Free(dictionary);
+    }
+
+    dictionary = BA_Configuration_ParseParallel("Small=Yes", 0);
+
+    BA_ASSERT(dictionary != NULL, "Failed to allocate memory for a dictionary\n");
+    BA_ASSERT(strcmp(BA_Configuration_GetValue(dictionary, "Small", BA_BOOLEAN_FALSE), "Yes") == 0, "Value does not match expected\n");
     BA_Configuration_Free(dictionary);
-}
\ No newline at end of file
+}
@@ -0,0 +1,188 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/ConfigurationWatcher.h>
+#include <BaconAPI/Configuration.h>
+#include <BaconAPI/Atomic.h>
+#include <BaconAPI/Thread.h>
+#include <BaconAPI/OperatingSystem.h>
+
+#define FILE_NAME "ConfigurationWatcherTest.settings"
+#define NUMBER_OF_READERS 4
+#define NUMBER_OF_RELOADS 50
+
+// Listeners run on the watcher thread, while these get read on the main thread
+typedef struct {
+    BA_Atomic_Integer changed;
+    BA_Atomic_Integer added;
+    BA_Atomic_Integer removed;
+    BA_Atomic_Integer keyChanged;
+} ChangeCounts;
+
+static BA_ConfigurationWatcher* watcher;
+static BA_Atomic_Integer readersStopping;
+
+static void WriteConfiguration(const char* contents) {
+    FILE* file = fopen(FILE_NAME ".new", "w");
+
+    BA_ASSERT(file != NULL, "Failed to create configuration file\n");
+    fputs(contents, file);
+    fclose(file);
+    remove(FILE_NAME);
+    BA_ASSERT(rename(FILE_NAME ".new", FILE_NAME) == 0, "Failed to replace configuration file\n");
+}
+
+static void CountChange(const char* key, const char* oldValue, const char* newValue, void* argument) {
+    ChangeCounts* counts = argument;
+
+    if (oldValue == NULL)
+        BA_ATOMIC_INCREMENT(&counts->added);
+    else if (newValue == NULL)
+        BA_ATOMIC_INCREMENT(&counts->removed);
+    else {
+        BA_ASSERT(strcmp(key, "same") != 0, "Unchanged key was reported\n");
+
+        BA_ATOMIC_INCREMENT(&counts->changed);
+    }
+}
+
+static void CountKeyChange(const char* key, const char* oldValue, const char* newValue, void* argument) {
+    BA_ASSERT(strcmp(key, "value") == 0, "Listener got the wrong key\n");
+
+    if (BA_ATOMIC_LOAD(&((ChangeCounts*) argument)->keyChanged) == 0)
+        BA_ASSERT(strcmp(oldValue, "1") == 0 && strcmp(newValue, "2") == 0, "Listener got the wrong values\n");
+
+    BA_ATOMIC_INCREMENT(&((ChangeCounts*) argument)->keyChanged);
+}
+
+static void ReadConstantly(void* argument) {
+    (void) argument;
+
+    while (!BA_ATOMIC_LOAD(&readersStopping)) {
+        int reader;
+        const BA_DynamicDictionary* snapshot = BA_ConfigurationWatcher_AcquireSnapshot(watcher, &reader);
+        const char* value = BA_Configuration_GetValue(snapshot, "counter", BA_BOOLEAN_FALSE);
+
+        BA_ASSERT(value != NULL && strlen(value) == 8, "Read a broken snapshot\n");
+        BA_ConfigurationWatcher_ReleaseSnapshot(watcher, reader);
+    }
+}
+
+void Test(void) {
+    ChangeCounts counts = {0};
+    int reader;
+
+    WriteConfiguration("same=Hello\nvalue=1\nremoved=Yes\n");
+
+    watcher = BA_ConfigurationWatcher_Open(FILE_NAME);
+
+    BA_ASSERT(watcher != NULL, "Failed to open configuration watcher\n");
+    BA_ASSERT(BA_ConfigurationWatcher_Open(FILE_NAME ".missing") == NULL, "Opened a missing file\n");
+    BA_ASSERT(BA_ConfigurationWatcher_AddListener(watcher, NULL, &CountChange, &counts), "Failed to add listener\n");
+    BA_ASSERT(BA_ConfigurationWatcher_AddListener(watcher, "value", &CountKeyChange, &counts), "Failed to add listener\n");
+
+    {
+        const BA_DynamicDictionary* oldSnapshot = BA_ConfigurationWatcher_AcquireSnapshot(watcher, &reader);
+
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(oldSnapshot, "value", BA_BOOLEAN_FALSE), "1") == 0, "Value does not match expected\n");
+        WriteConfiguration("same=Hello\nvalue=2\nadded=Yes\n");
+        BA_ASSERT(BA_ConfigurationWatcher_Reload(watcher), "Failed to reload configuration\n");
+
+        // Still ours until we let go of it
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(oldSnapshot, "value", BA_BOOLEAN_FALSE), "1") == 0, "Old snapshot was changed\n");
+        BA_ConfigurationWatcher_ReleaseSnapshot(watcher, reader);
+    }
+
+    BA_ASSERT(BA_ATOMIC_LOAD(&counts.changed) == 1 && BA_ATOMIC_LOAD(&counts.added) == 1 && BA_ATOMIC_LOAD(&counts.removed) == 1, "Listener was not told about every change\n");
+    BA_ASSERT(BA_ATOMIC_LOAD(&counts.keyChanged) == 1, "Key listener was not told about its key changing\n");
+
+    {
+        const BA_DynamicDictionary* snapshot = BA_ConfigurationWatcher_AcquireSnapshot(watcher, &reader);
+
+        BA_ASSERT(strcmp(BA_Configuration_GetValue(snapshot, "value", BA_BOOLEAN_FALSE), "2") == 0, "Reload did not give the new value\n");
+        BA_ASSERT(BA_Configuration_GetValue(snapshot, "removed", BA_BOOLEAN_FALSE) == NULL, "Removed key is still there\n");
+        BA_ConfigurationWatcher_ReleaseSnapshot(watcher, reader);
+    }
+
+    if (!BA_Thread_IsSingleThreaded()) {
+        BA_Thread readers[NUMBER_OF_READERS];
+        char contents[64];
+
+        // Noticing the change on its own
+        WriteConfiguration("same=Hello\nvalue=3\n");
+
+        {
+            time_t start = time(NULL);
+            BA_Boolean noticed = BA_BOOLEAN_FALSE;
+
+            while (!noticed && time(NULL) - start < 10) {
+                const BA_DynamicDictionary* snapshot = BA_ConfigurationWatcher_AcquireSnapshot(watcher, &reader);
+
+                noticed = strcmp(BA_Configuration_GetValue(snapshot, "value", BA_BOOLEAN_FALSE), "3") == 0;
+
+                BA_ConfigurationWatcher_ReleaseSnapshot(watcher, reader);
+            }
+
+            BA_ASSERT(noticed, "Configuration file change was not noticed\n");
+        }
+
+#if BA_OPERATINGSYSTEM_LINUX
+        // Creating, or truncating, the file isn't a change until it's finished being written. Reloading waits for the
+        // watcher thread to finish with its listeners first
+        BA_ASSERT(BA_ConfigurationWatcher_Reload(watcher), "Failed to reload configuration\n");
+
+        for (int created = 0; created < 2; created++) {
+            long changed = BA_ATOMIC_LOAD(&counts.changed);
+            long added = BA_ATOMIC_LOAD(&counts.added);
+            long removed = BA_ATOMIC_LOAD(&counts.removed);
+            time_t start = time(NULL);
+            FILE* file;
+
+            if (created)
+                remove(FILE_NAME);
+
+            file = fopen(FILE_NAME, "w");
+
+            BA_ASSERT(file != NULL, "Failed to open configuration file\n");
+
+            while (time(NULL) - start < 2) {
+                const BA_DynamicDictionary* snapshot = BA_ConfigurationWatcher_AcquireSnapshot(watcher, &reader);
+                const char* value = BA_Configuration_GetValue(snapshot, "value", BA_BOOLEAN_FALSE);
+
+                BA_ASSERT(value != NULL && strcmp(value, "3") == 0, "Unfinished file was published\n");
+                BA_ConfigurationWatcher_ReleaseSnapshot(watcher, reader);
+            }
+
+            BA_ASSERT(BA_ATOMIC_LOAD(&counts.changed) == changed && BA_ATOMIC_LOAD(&counts.added) == added && BA_ATOMIC_LOAD(&counts.removed) == removed,
+                      "Listener was told about an unfinished file\n");
+            fputs("same=Hello\nvalue=3\n", file);
+            fclose(file);
+        }
+#endif
+
+        WriteConfiguration("counter=00000000\n");
+        BA_ASSERT(BA_ConfigurationWatcher_Reload(watcher), "Failed to reload configuration\n");
+
+        for (int i = 0; i < NUMBER_OF_READERS; i++)
+            BA_ASSERT(BA_Thread_Create(&readers[i], &ReadConstantly, NULL, NULL), "Failed to create reader thread\n");
+
+        for (int i = 1; i <= NUMBER_OF_RELOADS; i++) {
+            sprintf(contents, "counter=%08i\n", i);
+            WriteConfiguration(contents);
+            BA_ASSERT(BA_ConfigurationWatcher_Reload(watcher), "Failed to reload configuration\n");
+        }
+
+        BA_ATOMIC_STORE(&readersStopping, BA_BOOLEAN_TRUE);
+
+        for (int i = 0; i < NUMBER_OF_READERS; i++)
+            BA_Thread_Join(readers[i], NULL);
+    }
+
+    BA_ConfigurationWatcher_Close(watcher);
+    remove(FILE_NAME);
+}
@@ -55,6 +55,14 @@ void Test(void) {
     ASSERT_SIZE(11);
     ASSERT_REALLOCATE(1);
 
+    unsigned int modifications = array.modifications;
+
+    BA_ASSERT(BA_DynamicArray_ReplaceElementAt(&array, 1, &number3), "Failed to replace element at index 1\n");
+    BA_ASSERT(array.internalArray[1] == &number3, "Element was not replaced\n");
+    BA_ASSERT(array.modifications == modifications + 1, "Replacing did not count as a modification\n");
+    BA_ASSERT(!BA_DynamicArray_ReplaceElementAt(&array, 2, &number3), "Replaced an element past the end\n");
+    ASSERT_USED(2);
+
     array.frozen = BA_BOOLEAN_TRUE;
 
     ASSERT_FROZEN(BA_DynamicArray_AddElementToStart(&array, &number1));
@@ -63,6 +71,7 @@ void Test(void) {
     ASSERT_FROZEN(BA_DynamicArray_RemoveLastElement(&array));
     ASSERT_FROZEN(BA_DynamicArray_RemoveElementAt(&array, 0));
     ASSERT_FROZEN(BA_DynamicArray_RemoveMatchedElement(&array, &number1, sizeof(int), BA_BOOLEAN_FALSE));
+    ASSERT_FROZEN(BA_DynamicArray_ReplaceElementAt(&array, 0, &number1));
     ASSERT_FROZEN(BA_DynamicArray_Shrink(&array));
     free(array.internalArray);
 }
@@ -0,0 +1,122 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdio.h>
+#include <string.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/FileStream.h>
+#include <BaconAPI/Thread.h>
+
+#define CHUNK_SIZE 4096
+#define NUMBER_OF_LINES 20000
+
+typedef struct {
+    size_t offset;
+    int chunks;
+} ChunkState;
+
+static BA_Boolean CheckChunk(const char* chunk, size_t length, void* userData) {
+    ChunkState* state = userData;
+
+    BA_ASSERT(length == CHUNK_SIZE || state->offset + length == NUMBER_OF_LINES * 6, "Only the last chunk can be short\n");
+
+    for (size_t i = 0; i < length; i++, state->offset++)
+        BA_ASSERT(chunk[i] == (state->offset % 6 == 5 ? '\n' : (char) ('0' + state->offset / 6 % 10)), "Chunk has the wrong contents\n");
+
+    state->chunks++;
+    return BA_BOOLEAN_TRUE;
+}
+
+static BA_Boolean CheckLine(char* line, size_t length, void* userData) {
+    int* lineNumber = userData;
+    char expected[6];
+
+    memset(expected, '0' + *lineNumber % 10, 5);
+    expected[5] = '\0';
+
+    BA_ASSERT(length == 5 && strcmp(line, expected) == 0, "Read the wrong line\n");
+
+    (*lineNumber)++;
+    return BA_BOOLEAN_TRUE;
+}
+
+static BA_Boolean StopEarly(const char* chunk, size_t length, void* userData) {
+    (void) chunk;
+    (void) length;
+    return ++*(int*) userData < 2;
+}
+
+void Test(void) {
+    FILE* file = tmpfile();
+
+    BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+
+    for (int i = 0; i < NUMBER_OF_LINES; i++) {
+        for (int j = 0; j < 5; j++)
+            fputc('0' + i % 10, file);
+
+        fputc('\n', file);
+    }
+
+    {
+        ChunkState state = {0, 0};
+
+        rewind(file);
+        BA_ASSERT(BA_FileStream_ForEachChunk(file, CHUNK_SIZE, &CheckChunk, &state), "Failed to read chunks\n");
+        BA_ASSERT(state.offset == NUMBER_OF_LINES * 6 && state.chunks == (NUMBER_OF_LINES * 6 + CHUNK_SIZE - 1) / CHUNK_SIZE, "Missed some chunks\n");
+    }
+
+    {
+        int lineNumber = 0;
+
+        rewind(file);
+        BA_ASSERT(BA_FileStream_ForEachLine(file, NULL, &CheckLine, &lineNumber), "Failed to read lines\n");
+        BA_ASSERT(lineNumber == NUMBER_OF_LINES, "Missed some lines\n");
+    }
+
+    // Closing while the reading thread is still going
+    {
+        int calls = 0;
+
+        rewind(file);
+        BA_ASSERT(BA_FileStream_ForEachChunk(file, CHUNK_SIZE, &StopEarly, &calls) && calls == 2, "Didn't stop early\n");
+    }
+
+    {
+        BA_FileStream* stream;
+        const char* chunk;
+
+        rewind(file);
+
+        stream = BA_FileStream_Open(file, CHUNK_SIZE);
+
+        BA_ASSERT(stream != NULL, "Failed to open stream\n");
+        BA_ASSERT(BA_FileStream_Next(stream, &chunk) == CHUNK_SIZE, "Failed to read chunk\n");
+        BA_ASSERT(BA_FileStream_IsReadingAhead(stream) != BA_Thread_IsSingleThreaded(), "Should be reading ahead, unless single-threaded\n");
+        BA_FileStream_Close(stream);
+    }
+
+    fclose(file);
+
+    // Small files never start a thread
+    {
+        BA_FileStream* stream;
+        const char* chunk;
+
+        file = tmpfile();
+
+        BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+        fputs("tiny", file);
+        rewind(file);
+
+        stream = BA_FileStream_Open(file, CHUNK_SIZE);
+
+        BA_ASSERT(stream != NULL, "Failed to open stream\n");
+        BA_ASSERT(BA_FileStream_Next(stream, &chunk) == 4 && memcmp(chunk, "tiny", 4) == 0, "Failed to read chunk\n");
+        BA_ASSERT(!BA_FileStream_IsReadingAhead(stream), "Started reading ahead for a tiny file\n");
+        BA_ASSERT(BA_FileStream_Next(stream, &chunk) == -1, "Read past the end of the file\n");
+        BA_FileStream_Close(stream);
+        fclose(file);
+    }
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/FileWriter.h>
+#include <BaconAPI/MappedFile.h>
+
+#define NUMBER_OF_RECORDS 100000
+
+static char* ReadBack(FILE* file, size_t* length) {
+    BA_MappedFile* mappedFile = BA_MappedFile_OpenFile(file, BA_MAPPEDFILE_ACCESS_NORMAL);
+    char* contents;
+
+    BA_ASSERT(mappedFile != NULL, "Failed to read file\n");
+
+    *length = BA_MappedFile_GetLength(mappedFile);
+    contents = malloc(*length + 1);
+
+    BA_ASSERT(contents != NULL, "Failed to allocate memory\n");
+    memcpy(contents, BA_MappedFile_GetData(mappedFile), *length);
+
+    contents[*length] = '\0';
+
+    BA_MappedFile_Close(mappedFile);
+    return contents;
+}
+
+void Test(void) {
+    FILE* file = tmpfile();
+    FILE* expectedFile = tmpfile();
+    static char big[10000];
+    BA_FileWriter* writer;
+
+    BA_ASSERT(file != NULL && expectedFile != NULL, "Failed to create temporary file\n");
+
+    for (size_t i = 0; i < sizeof(big); i++)
+        big[i] = (char) ('a' + i % 26);
+
+    // Tiny buffer, so every path gets hit. Checked against stdio
+    writer = BA_FileWriter_OpenFile(file, 1);
+
+    BA_ASSERT(writer != NULL, "Failed to create writer\n");
+
+    for (int i = 0; i < NUMBER_OF_RECORDS; i++) {
+        BA_FileWriter_Segment segments[3] = {{"<", 1}, {big, (size_t) (i % 7 == 0 ? 3000 : i % 50)}, {">\n", 2}};
+
+        BA_ASSERT(BA_FileWriter_WriteFormat(writer, "%d,", i), "Failed to write\n");
+        BA_ASSERT(BA_FileWriter_WriteCharacter(writer, 'x'), "Failed to write\n");
+        BA_ASSERT(BA_FileWriter_WriteVector(writer, segments, 3), "Failed to write\n");
+        fprintf(expectedFile, "%d,x<%.*s>\n", i, (int) segments[1].length, big);
+
+        if (i % 1000 == 0) {
+            BA_ASSERT(BA_FileWriter_Write(writer, big, sizeof(big)), "Failed to write\n");
+            fwrite(big, 1, sizeof(big), expectedFile);
+        }
+    }
+
+    BA_ASSERT(BA_FileWriter_Close(writer), "Failed to close writer\n");
+    fflush(expectedFile);
+
+    {
+        size_t length;
+        size_t expectedLength;
+        char* contents = ReadBack(file, &length);
+        char* expected = ReadBack(expectedFile, &expectedLength);
+
+        BA_ASSERT(length == expectedLength && memcmp(contents, expected, length) == 0, "Writer wrote the wrong contents\n");
+        free(contents);
+        free(expected);
+    }
+
+    fclose(file);
+    fclose(expectedFile);
+
+    // Flush policies
+    file = tmpfile();
+
+    BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+
+    writer = BA_FileWriter_OpenFile(file, 0);
+
+    BA_ASSERT(writer != NULL, "Failed to create writer\n");
+    BA_FileWriter_SetFlushPolicy(writer, BA_FILEWRITER_FLUSH_POLICY_SIZE, 10);
+    BA_FileWriter_WriteString(writer, "123456789");
+    BA_ASSERT(BA_FileWriter_GetBuffered(writer) == 9, "Flushed too early\n");
+    BA_FileWriter_WriteString(writer, "0");
+    BA_ASSERT(BA_FileWriter_GetBuffered(writer) == 0, "Didn't flush at the size limit\n");
+
+    BA_FileWriter_SetFlushPolicy(writer, BA_FILEWRITER_FLUSH_POLICY_TIME, 0);
+    BA_FileWriter_WriteString(writer, "a");
+    BA_ASSERT(BA_FileWriter_GetBuffered(writer) == 0, "Didn't flush after the time limit\n");
+
+    BA_FileWriter_SetFlushPolicy(writer, BA_FILEWRITER_FLUSH_POLICY_MANUAL, 0);
+    BA_FileWriter_WriteString(writer, "bc");
+    BA_ASSERT(BA_FileWriter_GetBuffered(writer) == 2, "Manual policy flushed by itself\n");
+    BA_ASSERT(BA_FileWriter_SetDurability(writer, BA_FILEWRITER_DURABILITY_SYNC), "Failed to enable sync\n");
+    BA_ASSERT(BA_FileWriter_GetBuffered(writer) == 0, "Changing durability didn't flush\n");
+
+    // Not every file system supports it, but it should still write everything when it does
+    if (BA_FileWriter_SetDurability(writer, BA_FILEWRITER_DURABILITY_DIRECT))
+        BA_FileWriter_Write(writer, big, sizeof(big));
+
+    BA_ASSERT(BA_FileWriter_Close(writer), "Failed to close writer\n");
+
+    {
+        size_t length;
+        char* contents = ReadBack(file, &length);
+
+        BA_ASSERT((length == 13 || length == 13 + sizeof(big)) && memcmp(contents, "1234567890abc", 13) == 0, "Writer wrote the wrong contents\n");
+        free(contents);
+    }
+
+    fclose(file);
+    BA_ASSERT(BA_FileWriter_Open("this/directory/does/not/exist", BA_BOOLEAN_FALSE, 0) == NULL, "Opened a file that doesn't exist\n");
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/Glob.h>
+
+#define GLOB_CHECK(pattern, string, caseless, expected) BA_ASSERT(BA_Glob_MatchOnce(pattern, string, caseless) == (expected), "Glob \"" pattern "\" against \"" string "\" failed\n")
+
+void Test(void) {
+    GLOB_CHECK("", "", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("", "a", BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+    GLOB_CHECK("*", "", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("*", "anything", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("hello", "hello", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("hello", "hello!", BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+    GLOB_CHECK("HeLLo", "hello", BA_BOOLEAN_TRUE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("h?llo", "hallo", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("*.txt", "notes.txt", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("*.txt", "notes.txt.bak", BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+    GLOB_CHECK("log.*", "log.network", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("a*b*c", "abc", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("a*b*c", "axxbyyc", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("a*b*c", "axxbyy", BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+    GLOB_CHECK("ab*ba", "aba", BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+    GLOB_CHECK("*middle*", "in the middle of it", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("*MIDDLE*", "in the middle of it", BA_BOOLEAN_TRUE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("*m?ddle*", "in the muddle of it", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("[a-c]at", "bat", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("[a-c]at", "rat", BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+    GLOB_CHECK("[!a-c]at", "rat", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("[A-C]at", "bat", BA_BOOLEAN_TRUE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("[]]", "]", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("[abc", "[abc", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("\\*", "*", BA_BOOLEAN_FALSE, BA_BOOLEAN_TRUE);
+    GLOB_CHECK("\\*", "a", BA_BOOLEAN_FALSE, BA_BOOLEAN_FALSE);
+
+    // This takes forever with a backtracking matcher
+    {
+        char string[201];
+        BA_Glob* glob = BA_Glob_Compile("a*a*a*a*a*a*a*a*a*a*a*a*b", BA_BOOLEAN_FALSE);
+
+        memset(string, 'a', 200);
+
+        string[200] = '\0';
+
+        BA_ASSERT(glob != NULL, "Failed to compile glob\n");
+        BA_ASSERT(!BA_Glob_Match(glob, string), "Pathological pattern matched\n");
+
+        string[199] = 'b';
+
+        BA_ASSERT(BA_Glob_Match(glob, string), "Pathological pattern didn't match\n");
+        BA_Glob_Free(glob);
+    }
+}
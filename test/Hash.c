@@ -0,0 +1,91 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+#include <stdint.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/Logger.h>
+#include <BaconAPI/Hash.h>
+
+#define DATA_LENGTH 5000
+
+typedef struct {
+    size_t length;
+    uint64_t hash;
+    uint64_t seededHash;
+} KnownHash;
+
+// Taken from the scalar version, every SIMD version has to match these
+static const KnownHash knownHashes[] = {
+    {0, 0x93228A4DE0EEC5A2ULL, 0x2AC44DB3DEB05300ULL},
+    {1, 0x9676022BFD177D90ULL, 0xF8656BBAFFCF166AULL},
+    {3, 0xE9609C2E635EB614ULL, 0xEE5AF0C23246B548ULL},
+    {8, 0xCA9F70FC67BBEA6DULL, 0xB7A15093927ED50FULL},
+    {17, 0xB3889B861F2AF496ULL, 0x80F3C1342EBF3CB1ULL},
+    {64, 0xC3740CA8602134A2ULL, 0xA10273B9004C53F7ULL},
+    {200, 0xF2C89221CE261C9FULL, 0x8EBAE01E9F70CA65ULL},
+    {256, 0x092B7FE68326F7F3ULL, 0x00932F16EA80B029ULL},
+    {257, 0x7F30A0B73C515622ULL, 0xFC8B871BE72FDA17ULL},
+    {320, 0xC3E58D7D65C47A9EULL, 0x2A21E24AB173E25AULL},
+    {1024, 0xE474D9B6B5142A48ULL, 0x0F46921477B18337ULL},
+    {1025, 0x9CC9E5DCBBDB30E3ULL, 0x40472BC7BD253C58ULL},
+    {4999, 0x54B92FA16C66E4D4ULL, 0xEE19E145C9A74B6FULL}
+};
+
+void Test(void) {
+    static unsigned char data[DATA_LENGTH];
+    uint16_t endianTest = 1;
+
+    for (int i = 0; i < DATA_LENGTH; i++)
+        data[i] = (unsigned char) (i * 31 + 7);
+
+    BA_LOGGER_INFO("Hash implementation: %s\n", BA_Hash_GetImplementation());
+
+    // Known hashes are little endian only
+    if (*(unsigned char*) &endianTest == 1) {
+        for (size_t i = 0; i < sizeof(knownHashes) / sizeof(KnownHash); i++) {
+            BA_ASSERT(BA_Hash_Bytes(data, knownHashes[i].length) == knownHashes[i].hash, "Hash doesn't match the scalar version\n");
+            BA_ASSERT(BA_Hash_BytesSeeded(data, knownHashes[i].length, 42) == knownHashes[i].seededHash, "Seeded hash doesn't match the scalar version\n");
+        }
+    }
+
+    BA_ASSERT(BA_Hash_String("Hello, World!") == BA_Hash_Bytes("Hello, World!", 13), "String hash is different from byte hash\n");
+    BA_ASSERT(BA_Hash_WideString(L"Hello") == BA_Hash_Bytes(L"Hello", 5 * sizeof(wchar_t)), "Wide string hash is different from byte hash\n");
+    BA_ASSERT(BA_Hash_String("Hello") != BA_Hash_String("hello"), "Different strings gave the same hash\n");
+    BA_ASSERT(BA_Hash_Integer(1) != BA_Hash_Integer(2), "Different integers gave the same hash\n");
+    BA_ASSERT(BA_Hash_Combine(1, 2) != BA_Hash_Combine(2, 1), "Combine shouldn't be symmetric\n");
+
+    // Streaming has to give the same hash no matter how the input gets split up
+    for (size_t length = 0; length <= 1100; length += length < 300 ? 1 : 37) {
+        uint64_t expected = BA_Hash_BytesSeeded(data, length, 7);
+        size_t pieceSizes[] = {1, 13, 64, 100, 256, 257};
+
+        BA_ASSERT(length == 0 || BA_Hash_BytesSeeded(data, length, 8) != expected, "Seed didn't change the hash\n");
+
+        for (size_t i = 0; i < sizeof(pieceSizes) / sizeof(size_t); i++) {
+            BA_Hash_State state;
+
+            BA_Hash_Start(&state, 7);
+
+            for (size_t offset = 0; offset < length; offset += pieceSizes[i]) {
+                size_t left = length - offset;
+
+                BA_Hash_Update(&state, data + offset, left < pieceSizes[i] ? left : pieceSizes[i]);
+            }
+
+            BA_ASSERT(BA_Hash_Finish(&state) == expected, "Streaming hash is different from one shot hash\n");
+        }
+    }
+
+    // Finishing shouldn't stop us from adding more
+    {
+        BA_Hash_State state;
+
+        BA_Hash_Start(&state, 0);
+        BA_Hash_Update(&state, data, 3000);
+        BA_ASSERT(BA_Hash_Finish(&state) == BA_Hash_Bytes(data, 3000), "Streaming hash is different from one shot hash\n");
+        BA_Hash_Update(&state, data + 3000, 2000);
+        BA_ASSERT(BA_Hash_Finish(&state) == BA_Hash_Bytes(data, 5000), "Updating after finishing broke the hash\n");
+    }
+}
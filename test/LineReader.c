@@ -0,0 +1,82 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/LineReader.h>
+#include <BaconAPI/String.h>
+
+static const char* contents = "first\r\n\r\nthird line is a lot longer than the block size\r\nends with a lone \r\rcarriage return\r\nlast";
+static const char* expectedLines[] = {"first", "", "third line is a lot longer than the block size", "ends with a lone \r\rcarriage return", "last"};
+
+void Test(void) {
+    FILE* file = tmpfile();
+
+    BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+    fputs(contents, file);
+
+    // Small blocks make the delimiter land across every possible boundary
+    for (size_t blockSize = 1; blockSize <= 16; blockSize++) {
+        BA_LineReader* reader;
+        char* line;
+        intmax_t length;
+        int lineNumber = 0;
+
+        rewind(file);
+        reader = BA_LineReader_Create(file, "\r\n", blockSize);
+
+        BA_ASSERT(reader != NULL, "Failed to create line reader\n");
+
+        while ((length = BA_LineReader_Next(reader, &line)) != -1) {
+            BA_ASSERT(length >= 0, "Failed to read line\n");
+            BA_ASSERT(lineNumber < 5 && strcmp(line, expectedLines[lineNumber]) == 0 && (size_t) length == strlen(line), "Read the wrong line\n");
+            lineNumber++;
+        }
+
+        BA_ASSERT(lineNumber == 5, "Wrong amount of lines\n");
+        BA_ASSERT(BA_LineReader_Next(reader, NULL) == -1, "Read past the end of the file\n");
+        BA_LineReader_Free(reader);
+    }
+
+    // BA_String_GetLine should agree
+    {
+        char* line;
+        int lineNumber = 0;
+
+        rewind(file);
+
+        while (BA_String_GetLine(file, &line, "\r\n") != -1) {
+            BA_ASSERT(lineNumber < 5 && strcmp(line, expectedLines[lineNumber]) == 0, "BA_String_GetLine read the wrong line\n");
+            free(line);
+            lineNumber++;
+        }
+
+        BA_ASSERT(lineNumber == 5, "BA_String_GetLine read the wrong amount of lines\n");
+    }
+
+    // Default delimiter, with a trailing newline
+    {
+        BA_LineReader* reader;
+        char* line;
+
+        fclose(file);
+        file = tmpfile();
+
+        BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+        fputs("a\nb\n", file);
+        rewind(file);
+
+        reader = BA_LineReader_Create(file, NULL, 0);
+
+        BA_ASSERT(reader != NULL, "Failed to create line reader\n");
+        BA_ASSERT(BA_LineReader_Next(reader, &line) == 1 && line[0] == 'a', "Read the wrong line\n");
+        BA_ASSERT(BA_LineReader_Next(reader, &line) == 1 && line[0] == 'b', "Read the wrong line\n");
+        BA_ASSERT(BA_LineReader_Next(reader, &line) == -1, "Trailing newline shouldn't give an extra line\n");
+        BA_LineReader_Free(reader);
+    }
+
+    fclose(file);
+}
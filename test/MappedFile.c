@@ -0,0 +1,93 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/MappedFile.h>
+#include <BaconAPI/String.h>
+#include <BaconAPI/OperatingSystem.h>
+
+#define BIG_FILE_SIZE (3 * 1024 * 1024 + 123)
+
+void Test(void) {
+    FILE* file = tmpfile();
+    BA_MappedFile* mappedFile;
+
+    BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+    fputs("Hello, World!", file);
+    fflush(file);
+
+    mappedFile = BA_MappedFile_OpenFile(file, BA_MAPPEDFILE_ACCESS_SEQUENTIAL);
+
+    BA_ASSERT(mappedFile != NULL, "Failed to map file\n");
+    BA_ASSERT(BA_MappedFile_GetLength(mappedFile) == 13 && memcmp(BA_MappedFile_GetData(mappedFile), "Hello, World!", 13) == 0, "Mapped file has the wrong contents\n");
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT || BA_OPERATINGSYSTEM_WINDOWS
+    BA_ASSERT(BA_MappedFile_IsMapped(mappedFile), "Regular files should be mapped\n");
+#endif
+    BA_MappedFile_Close(mappedFile);
+
+    {
+        size_t length;
+        char* contents = BA_String_ReadFile(file, 0, &length);
+
+        BA_ASSERT(contents != NULL && length == 13 && strcmp(contents, "Hello, World!") == 0, "BA_String_ReadFile read the wrong contents\n");
+        free(contents);
+    }
+
+    fclose(file);
+
+    // Big enough to try huge pages
+    {
+        char* data = malloc(BIG_FILE_SIZE);
+
+        BA_ASSERT(data != NULL, "Failed to allocate memory\n");
+
+        for (size_t i = 0; i < BIG_FILE_SIZE; i++)
+            data[i] = (char) (i * 13);
+
+        file = tmpfile();
+
+        BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+        BA_ASSERT(fwrite(data, 1, BIG_FILE_SIZE, file) == BIG_FILE_SIZE, "Failed to write temporary file\n");
+        fflush(file);
+
+        mappedFile = BA_MappedFile_OpenFile(file, BA_MAPPEDFILE_ACCESS_RANDOM);
+
+        BA_ASSERT(mappedFile != NULL, "Failed to map file\n");
+        BA_ASSERT(BA_MappedFile_GetLength(mappedFile) == BIG_FILE_SIZE && memcmp(BA_MappedFile_GetData(mappedFile), data, BIG_FILE_SIZE) == 0, "Mapped file has the wrong contents\n");
+        fclose(file);
+        BA_ASSERT(BA_MappedFile_GetData(mappedFile)[BIG_FILE_SIZE - 1] == data[BIG_FILE_SIZE - 1], "Mapping should outlive the file\n");
+        BA_MappedFile_Close(mappedFile);
+        free(data);
+    }
+
+    // Empty files can't be mapped, so this goes through the read fallback
+    file = tmpfile();
+
+    BA_ASSERT(file != NULL, "Failed to create temporary file\n");
+
+    mappedFile = BA_MappedFile_OpenFile(file, BA_MAPPEDFILE_ACCESS_NORMAL);
+
+    BA_ASSERT(mappedFile != NULL && BA_MappedFile_GetLength(mappedFile) == 0 && !BA_MappedFile_IsMapped(mappedFile), "Failed to read empty file\n");
+    BA_MappedFile_Close(mappedFile);
+    fclose(file);
+
+#if BA_OPERATINGSYSTEM_POSIX_COMPLIANT
+    // Pipes can't be mapped either
+    file = popen("echo piped", "r");
+
+    BA_ASSERT(file != NULL, "Failed to open pipe\n");
+
+    mappedFile = BA_MappedFile_OpenFile(file, BA_MAPPEDFILE_ACCESS_NORMAL);
+
+    BA_ASSERT(mappedFile != NULL && !BA_MappedFile_IsMapped(mappedFile), "Failed to read pipe\n");
+    BA_ASSERT(BA_MappedFile_GetLength(mappedFile) == 6 && memcmp(BA_MappedFile_GetData(mappedFile), "piped\n", 6) == 0, "Pipe has the wrong contents\n");
+    BA_MappedFile_Close(mappedFile);
+    pclose(file);
+#endif
+
+    BA_ASSERT(BA_MappedFile_Open("this/file/does/not/exist", BA_MAPPEDFILE_ACCESS_NORMAL) == NULL, "Opened a file that doesn't exist\n");
+}
@@ -20,6 +20,12 @@ do {                             \
         NUMBER_FUNCTION(to, "test", 0, BA_BOOLEAN_TRUE, "test"); \
         NUMBER_FUNCTION(to, "1test", 0, BA_BOOLEAN_TRUE, "test"); \
 } while (0)
+#define NUMBER_TO_STRING(function, number, expected) \
+do {                                                 \
+    char buffer[BA_NUMBER_DOUBLE_BUFFER_SIZE];       \
+    BA_ASSERT(BA_Number_ ## function(number, buffer) == strlen(expected), "Length did not match expected\n"); \
+    BA_ASSERT(strcmp(buffer, expected) == 0, "String did not match expected\n"); \
+} while (BA_BOOLEAN_FALSE)
 
 void Test(void) {
     NUMBER_FUNCTION_TEST(Character);
@@ -32,4 +38,22 @@ void Test(void) {
     NUMBER_FUNCTION_TEST(UnsignedLong);
     NUMBER_FUNCTION_TEST(LongLong);
     NUMBER_FUNCTION_TEST(UnsignedLongLong);
+    BA_ASSERT(BA_Number_GetDigitCount(0) == 1, "Zero should have one digit\n");
+    BA_ASSERT(BA_Number_GetDigitCount(99) == 2, "Digit count did not match expected\n");
+    BA_ASSERT(BA_Number_GetDigitCount(100) == 3, "Digit count did not match expected\n");
+    BA_ASSERT(BA_Number_GetDigitCount(UINT64_MAX) == 20, "Digit count did not match expected\n");
+    NUMBER_TO_STRING(UnsignedLongToString, 0, "0");
+    NUMBER_TO_STRING(UnsignedLongToString, UINT64_MAX, "18446744073709551615");
+    NUMBER_TO_STRING(LongToString, -42, "-42");
+    NUMBER_TO_STRING(LongToString, INT64_MIN, "-9223372036854775808");
+    NUMBER_TO_STRING(DoubleToString, 0.1, "0.1");
+    NUMBER_TO_STRING(DoubleToString, -0.0, "-0.0");
+    NUMBER_TO_STRING(DoubleToString, 3.0, "3.0");
+    NUMBER_TO_STRING(DoubleToString, 1234.5678, "1234.5678");
+    NUMBER_TO_STRING(DoubleToString, 0.0001, "0.0001");
+    NUMBER_TO_STRING(DoubleToString, 0.00001, "1e-05");
+    NUMBER_TO_STRING(DoubleToString, 1e16, "1e+16");
+    NUMBER_TO_STRING(DoubleToString, 5e-324, "5e-324");
+    NUMBER_TO_STRING(DoubleToString, 1.7976931348623157e308, "1.7976931348623157e+308");
+    NUMBER_TO_STRING(DoubleToString, 1.0 / 0.0, "inf");
 }
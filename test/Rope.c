@@ -0,0 +1,120 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+#include <stdlib.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/Rope.h>
+
+#define NUMBER_OF_EDITS 3000
+#define MAX_LENGTH 200000
+
+static char reference[MAX_LENGTH + 4096];
+static size_t referenceLength = 0;
+
+static void CheckReference(const BA_Rope* rope) {
+    char* flattened = BA_Rope_ToString(rope);
+
+    BA_ASSERT(flattened != NULL, "Failed to flatten rope\n");
+    BA_ASSERT(BA_Rope_GetLength(rope) == referenceLength && memcmp(flattened, reference, referenceLength) == 0, "Rope doesn't match the reference\n");
+    free(flattened);
+}
+
+void Test(void) {
+    BA_Rope* rope = BA_Rope_Create("Hello\nWorld");
+
+    BA_ASSERT(rope != NULL, "Failed to create rope\n");
+    BA_ASSERT(BA_Rope_GetLineAmount(rope) == 2 && BA_Rope_GetLineStart(rope, 1) == 6, "Line index is wrong\n");
+    BA_ASSERT(BA_Rope_Insert(rope, 5, ", there") && BA_Rope_Append(rope, "!\n") && BA_Rope_Prepend(rope, ">"), "Failed to insert\n");
+
+    {
+        char* string = BA_Rope_ToString(rope);
+        char* line = BA_Rope_GetLine(rope, 1);
+        BA_DynamicArray* lines = BA_Rope_SplitLines(rope);
+
+        BA_ASSERT(strcmp(string, ">Hello, there\nWorld!\n") == 0, "Rope has the wrong contents\n");
+        BA_ASSERT(strcmp(line, "World!") == 0, "Got the wrong line\n");
+        BA_ASSERT(lines->used == 3 && strcmp(lines->internalArray[0], ">Hello, there") == 0 && ((char*) lines->internalArray[2])[0] == '\0', "Split lines are wrong\n");
+        BA_ASSERT(BA_Rope_GetLineFromPosition(rope, 15) == 1, "Got the wrong line for position\n");
+        BA_ASSERT(BA_Rope_GetLine(rope, 3) == NULL, "Got a line that doesn't exist\n");
+
+        for (int i = 0; i < lines->used; i++)
+            free(lines->internalArray[i]);
+
+        free(lines->internalArray);
+        free(lines);
+        free(line);
+        free(string);
+    }
+
+    BA_Rope_Delete(rope, 0, BA_Rope_GetLength(rope));
+    BA_ASSERT(BA_Rope_GetLength(rope) == 0 && BA_Rope_GetLineAmount(rope) == 1, "Failed to delete everything\n");
+
+    // Random edits, checked against a flat string doing the same thing
+    srand(1234);
+
+    for (int i = 0; i < NUMBER_OF_EDITS; i++) {
+        int operation = rand() % 4;
+        size_t position = referenceLength > 0 ? (size_t) rand() % (referenceLength + 1) : 0;
+
+        if (operation < 2 || referenceLength < 1000) {
+            char insert[3000];
+            size_t length = operation == 0 ? (size_t) rand() % sizeof(insert) : (size_t) rand() % 20 + 1;
+
+            if (referenceLength + length > MAX_LENGTH)
+                continue;
+
+            for (size_t j = 0; j < length; j++)
+                insert[j] = rand() % 10 == 0 ? '\n' : (char) ('a' + rand() % 26);
+
+            BA_ASSERT(BA_Rope_InsertLength(rope, position, insert, length), "Failed to insert\n");
+            memmove(reference + position + length, reference + position, referenceLength - position);
+            memcpy(reference + position, insert, length);
+
+            referenceLength += length;
+        } else {
+            size_t length = operation == 2 ? (size_t) rand() % 5000 : (size_t) rand() % 10;
+
+            if (length > referenceLength - position)
+                length = referenceLength - position;
+
+            BA_Rope_Delete(rope, position, length);
+            memmove(reference + position, reference + position + length, referenceLength - position - length);
+
+            referenceLength -= length;
+        }
+
+        if (i % 100 == 0) {
+            size_t newlines = 0;
+
+            CheckReference(rope);
+
+            for (size_t j = 0; j < referenceLength; j++) {
+                if (reference[j] != '\n')
+                    continue;
+
+                newlines++;
+
+                BA_ASSERT(BA_Rope_GetLineStart(rope, newlines) == j + 1, "Line start is wrong\n");
+                BA_ASSERT(BA_Rope_GetLineFromPosition(rope, j + 1) == newlines, "Line from position is wrong\n");
+            }
+
+            BA_ASSERT(BA_Rope_GetLineAmount(rope) == newlines + 1, "Line amount is wrong\n");
+
+            if (referenceLength > 0)
+                BA_ASSERT(BA_Rope_GetCharacter(rope, referenceLength / 2) == reference[referenceLength / 2], "Got the wrong character\n");
+        }
+    }
+
+    CheckReference(rope);
+
+    {
+        char* substring = BA_Rope_GetSubstring(rope, referenceLength / 3, 100);
+
+        BA_ASSERT(substring != NULL && memcmp(substring, reference + referenceLength / 3, strlen(substring)) == 0, "Substring is wrong\n");
+        free(substring);
+    }
+
+    BA_Rope_Free(rope);
+}
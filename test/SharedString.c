@@ -0,0 +1,78 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/SharedString.h>
+#include <BaconAPI/StringManager.h>
+#include <BaconAPI/String.h>
+#include <BaconAPI/Thread.h>
+
+#define NUMBER_OF_THREADS 4
+#define NUMBER_OF_RETAINS 10000
+
+static const char* sharedString;
+
+void ThreadFunction(void* argument) {
+    for (int i = 0; i < NUMBER_OF_RETAINS; i++)
+        BA_SharedString_Retain(sharedString);
+
+    for (int i = 0; i < NUMBER_OF_RETAINS; i++)
+        BA_SharedString_Release(sharedString);
+}
+
+void Test(void) {
+    const char* original = BA_SharedString_Create("Hello");
+    const char* copy = BA_SharedString_Retain(original);
+
+    BA_ASSERT(original != NULL && copy == original, "Copying should give back the same string\n");
+    BA_ASSERT(BA_SharedString_GetReferenceCount(original) == 2, "Wrong reference count\n");
+    BA_ASSERT(BA_SharedString_GetLength(original) == 5, "Wrong length\n");
+    BA_ASSERT(BA_String_Equals(original, "Hello", BA_BOOLEAN_FALSE), "Shared string should work with normal string functions\n");
+    BA_ASSERT(BA_SharedString_Append(&copy, ", World!") && copy != original, "Append should have copied\n");
+    BA_ASSERT(strcmp(original, "Hello") == 0 && strcmp(copy, "Hello, World!") == 0, "Copy-on-write changed the original\n");
+    BA_ASSERT(BA_SharedString_GetReferenceCount(original) == 1 && BA_SharedString_GetReferenceCount(copy) == 1, "Copy-on-write didn't move the reference\n");
+
+    BA_ASSERT(BA_SharedString_Append(&copy, copy) && strcmp(copy, "Hello, World!Hello, World!") == 0, "Failed to append to itself\n");
+    BA_ASSERT(BA_SharedString_GetMutable(&copy) == copy, "Unique string shouldn't get copied\n");
+
+    {
+        const char* other = BA_SharedString_Retain(original);
+        char* mutable = BA_SharedString_GetMutable(&other);
+
+        BA_ASSERT(mutable != NULL && mutable != original, "Shared string should get copied before writing\n");
+
+        mutable[0] = 'J';
+
+        BA_ASSERT(strcmp(original, "Hello") == 0 && strcmp(other, "Jello") == 0, "Writing changed the original\n");
+        BA_SharedString_Release(other);
+    }
+
+    {
+        int index = BA_StringManager_AllocateShared(original);
+
+        BA_ASSERT(BA_StringManager_Get(index) == original, "String manager copied a shared string\n");
+        BA_ASSERT(BA_SharedString_GetReferenceCount(original) == 2, "String manager didn't take a reference\n");
+        BA_StringManager_Deallocate(index);
+        BA_ASSERT(BA_SharedString_GetReferenceCount(original) == 1, "String manager didn't release its reference\n");
+    }
+
+    if (!BA_Thread_IsSingleThreaded()) {
+        BA_Thread threads[NUMBER_OF_THREADS];
+
+        sharedString = original;
+
+        for (int i = 0; i < NUMBER_OF_THREADS; i++)
+            BA_ASSERT(BA_Thread_Create(&threads[i], &ThreadFunction, NULL, NULL), "Failed to create thread\n");
+
+        for (int i = 0; i < NUMBER_OF_THREADS; i++)
+            BA_ASSERT(BA_Thread_Join(threads[i], NULL), "Failed to join thread\n");
+
+        BA_ASSERT(BA_SharedString_GetReferenceCount(original) == 1, "Reference count got lost between threads\n");
+    }
+
+    BA_SharedString_Release(original);
+    BA_SharedString_Release(copy);
+    BA_StringManager_Deallocate(-1);
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/StringBuilder.h>
+#include <BaconAPI/String.h>
+#include <BaconAPI/Debugging/Assert.h>
+
+void Test(void) {
+    {
+        BA_StringBuilder builder;
+
+        BA_ASSERT(BA_StringBuilder_Create(&builder, 4), "Failed to create builder\n");
+        BA_ASSERT(BA_StringBuilder_Append(&builder, "Hello"), "Failed to append\n");
+        BA_ASSERT(BA_StringBuilder_AppendCharacter(&builder, ','), "Failed to append character\n");
+        BA_ASSERT(BA_StringBuilder_AppendFormat(&builder, " %s%c %i", "World", '!', 42), "Failed to append format\n");
+        BA_ASSERT(builder.length == 16, "Length did not match expected\n");
+        BA_ASSERT(BA_String_Equals(builder.buffer, "Hello, World! 42", BA_BOOLEAN_FALSE), "Builder did not match expected\n");
+        BA_StringBuilder_Clear(&builder);
+        BA_ASSERT(builder.length == 0 && builder.buffer[0] == '\0', "Failed to clear builder\n");
+        BA_StringBuilder_Free(&builder);
+    }
+
+    {
+        char storage[8];
+        BA_StringBuilder builder;
+
+        BA_StringBuilder_CreateFromBuffer(&builder, storage, sizeof(storage));
+        BA_ASSERT(BA_StringBuilder_AppendFormat(&builder, "%i", 1234), "Failed to append format\n");
+        BA_ASSERT(builder.buffer == storage, "Moved to the heap too early\n");
+        BA_ASSERT(BA_StringBuilder_AppendFormat(&builder, "%s", "Goodbye, Moon!"), "Failed to append format\n");
+        BA_ASSERT(builder.buffer != storage && builder.ownsBuffer, "Did not move to the heap\n");
+
+        char* finished = BA_StringBuilder_Finish(&builder);
+
+        BA_ASSERT(BA_String_Equals(finished, "1234Goodbye, Moon!", BA_BOOLEAN_FALSE), "Finished string did not match expected\n");
+        free(finished);
+    }
+
+    {
+        BA_StringBuilder* builder = BA_StringBuilder_GetThreadLocal();
+
+        BA_ASSERT(BA_StringBuilder_AppendFormat(builder, "%s", "Hello"), "Failed to append format\n");
+        BA_ASSERT(BA_StringBuilder_GetThreadLocal()->length == 0, "Thread local builder did not get cleared\n");
+        BA_StringBuilder_FreeThreadLocal();
+    }
+
+    {
+        char buffer[16];
+
+        BA_ASSERT(BA_String_FormatInto(NULL, 0, "%s %i", "Hello", 10) == 8, "Failed to calculate length\n");
+        BA_ASSERT(BA_String_FormatInto(buffer, sizeof(buffer), "%s %i", "Hello", 10) == 8, "Length did not match expected\n");
+        BA_ASSERT(BA_String_Equals(buffer, "Hello 10", BA_BOOLEAN_FALSE), "Buffer did not match expected\n");
+    }
+}
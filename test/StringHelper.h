@@ -100,9 +100,30 @@ STRING_HELPER_SPLIT_FOOTER()
 #define STRING_HELPER_TEST_APPEND_CHARACTER(name, string1, character, expected) STRING_HELPER_COPY_STRING_BASE(name, string1, expected, AppendCharacter, results, STRING_HELPER_PARSE_STRING(name, character))
 #define STRING_HELPER_TEST_PREPEND_CHARACTER(name, string1, character, expected) STRING_HELPER_COPY_STRING_BASE(name, string1, expected, PrependCharacter, results, STRING_HELPER_PARSE_STRING(name, character))
 #define STRING_HELPER_TEST_FORMAT(name, string1, string2, expected) STRING_HELPER_COPY_STRING_BASE(name, string1, expected, Format, results, STRING_HELPER_PARSE_STRING(name, string2))
+#define STRING_HELPER_TEST_FORMAT_INTO(name, string1, string2, expected) \
+STRING_HELPER_HEADER()                                                    \
+    STRING_HELPER_TYPE(name) buffer[32];                                  \
+    STRING_HELPER_TYPE(name) smallBuffer[4];                              \
+    BA_ASSERT(STRING_HELPER_GET_FUNCTION(name, FormatInto)(buffer, 32, STRING_HELPER_PARSE_STRING(name, string1), STRING_HELPER_PARSE_STRING(name, string2)) == sizeof(expected) - 1, "Formatted length did not match expected\n"); \
+    STRING_HELPER_DO_TEST(name, BA_BOOLEAN_TRUE, "String did not match outcome\n", Equals, buffer, STRING_HELPER_PARSE_STRING(name, expected), BA_BOOLEAN_FALSE); \
+    int truncatedLength = STRING_HELPER_GET_FUNCTION(name, FormatInto)(smallBuffer, 4, STRING_HELPER_PARSE_STRING(name, string1), STRING_HELPER_PARSE_STRING(name, string2)); \
+    BA_ASSERT(truncatedLength == -1 || truncatedLength == sizeof(expected) - 1, "Truncated length did not match expected\n"); \
+STRING_HELPER_FOOTER()
 #define STRING_HELPER_TEST_SPLIT(name, string1, splitBy, expected1, expected2) STRING_HELPER_SPLIT_BASE(name, string1, splitBy, Split, expected1, expected2)
 #define STRING_HELPER_TEST_SPLIT_CHARACTER(name, string1, splitByCharacter, expected1, expected2) STRING_HELPER_SPLIT_BASE(name, string1, splitByCharacter, SplitCharacter, expected1, expected2)
 #define STRING_HELPER_TEST_FORMAT_SAFE(name, string1, string2, expected) STRING_HELPER_COPY_STRING_BASE(name, string1, expected, FormatSafe, results, 1, string2)
+#define STRING_HELPER_TEST_FORMAT_SAFE_COMPILED(name, string1, argument1, argument2, expected1, expected2) \
+STRING_HELPER_HEADER()                                                    \
+    BA_StringSafeFormat_Template* compiledTemplate = STRING_HELPER_GET_FUNCTION(name, CompileFormatSafe)(STRING_HELPER_PARSE_STRING(name, string1)); \
+    BA_ASSERT(compiledTemplate != NULL, "Failed to compile template\n"); \
+    STRING_HELPER_TYPE(name)* results = STRING_HELPER_GET_FUNCTION(name, FormatSafeCompiled)(compiledTemplate, 2, argument1, argument2); \
+    STRING_HELPER_DO_TEST(name, BA_BOOLEAN_TRUE, "String did not match outcome\n", Equals, results, STRING_HELPER_PARSE_STRING(name, expected1), BA_BOOLEAN_FALSE); \
+    free(results);                                                        \
+    results = STRING_HELPER_GET_FUNCTION(name, FormatSafeCompiled)(compiledTemplate, 1, argument1); \
+    STRING_HELPER_DO_TEST(name, BA_BOOLEAN_TRUE, "String did not match outcome\n", Equals, results, STRING_HELPER_PARSE_STRING(name, expected2), BA_BOOLEAN_FALSE); \
+    free(results);                                                        \
+    BA_StringSafeFormat_FreeTemplate(compiledTemplate);                   \
+STRING_HELPER_FOOTER()
 #define STRING_HELPER_TEST_REPLACE(name, string1, string2, string3, expected) STRING_HELPER_COPY_STRING_BASE(name, string1, expected, Replace, results, STRING_HELPER_PARSE_STRING(name, string2), STRING_HELPER_PARSE_STRING(name, string3))
 #define STRING_HELPER_TEST_REPLACE_CHARACTER(name, string1, character1, character2, expected) STRING_HELPER_COPY_STRING_BASE(name, string1, expected, ReplaceCharacter, results, STRING_HELPER_PARSE_STRING(name, character1), STRING_HELPER_PARSE_STRING(name, character2))
 #define STRING_HELPER_JOIN(name, string1, splitBy) STRING_HELPER_JOIN_BASE(name, string1, splitBy, Split, Join)
@@ -139,11 +160,14 @@ STRING_HELPER_TEST_TO_UPPER(name, "Goodbye, Moon!", "GOODBYE, MOON!"); \
 STRING_HELPER_TEST_APPEND_CHARACTER(name, "Hello, World", '!', "Hello, World!"); \
 STRING_HELPER_TEST_PREPEND_CHARACTER(name, "oodbye, Moon!", 'G', "Goodbye, Moon!"); \
 STRING_HELPER_TEST_FORMAT(name, "Hello, " STRING_HELPER_FORMATTER_CODE(name), "World!", "Hello, World!"); \
+STRING_HELPER_TEST_FORMAT_INTO(name, "Hello, " STRING_HELPER_FORMATTER_CODE(name), "World!", "Hello, World!"); \
 STRING_HELPER_TEST_SPLIT(name, "Goodbye, Moon!", " ", "Goodbye,", "Moon!"); \
 STRING_HELPER_TEST_SPLIT_CHARACTER(name, "Hello, World!", ' ', "Hello,", "World!"); \
 STRING_HELPER_TEST_FORMAT_SAFE(name, "%s Moon! % %s %i %% %", BA_STRINGSAFEFORMAT_ARGUMENT_STRING("Goodbye,"), "Goodbye, Moon! % %s %i %% %"); \
 BA_ASSERT(BA_StringSafeFormat_AddCustomSafeFormatter(1, &BooleanSafeFormat), "Failed to add custom safe formatter\n"); \
+STRING_HELPER_TEST_FORMAT_SAFE(name, "Pi is about %s", BA_STRINGSAFEFORMAT_ARGUMENT_DOUBLE(3.14), "Pi is about 3.14"); \
 STRING_HELPER_TEST_FORMAT_SAFE(name, "Said hello to world? %s", STRING_HELPER_ARGUMENT_BOOLEAN(BA_BOOLEAN_TRUE), "Said hello to world? Yes"); \
+STRING_HELPER_TEST_FORMAT_SAFE_COMPILED(name, "%s is %s years old %%s %", BA_STRINGSAFEFORMAT_ARGUMENT_STRING("Bob"), BA_STRINGSAFEFORMAT_ARGUMENT_INTEGER(42), "Bob is 42 years old %%s %", "Bob is %s years old %%s %"); \
 STRING_HELPER_TYPE(name)* empty = STRING_HELPER_GET_FUNCTION(name, CreateEmpty)(); \
 BA_ASSERT(empty != NULL, "Failed to create an empty string\n"); \
 free(empty);                       \
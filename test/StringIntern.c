@@ -0,0 +1,91 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdio.h>
+#include <string.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/StringIntern.h>
+#include <BaconAPI/String.h>
+#include <BaconAPI/Thread.h>
+
+#define NUMBER_OF_THREADS 4
+#define NUMBER_OF_STRINGS 500
+
+static const char* threadResults[NUMBER_OF_THREADS][NUMBER_OF_STRINGS];
+static int threadIndex = 0;
+static BA_Thread_Lock indexLock;
+
+void ThreadFunction(void* argument) {
+    char buffer[32];
+
+    BA_Thread_UseLock(&indexLock);
+
+    int index = threadIndex++;
+
+    BA_Thread_Unlock(&indexLock);
+
+    for (int i = 0; i < NUMBER_OF_STRINGS; i++) {
+        snprintf(buffer, sizeof(buffer), "key%i", i);
+
+        threadResults[index][i] = BA_StringIntern_Intern(buffer);
+    }
+}
+
+void Test(void) {
+    char buffer[] = "Hello, World!";
+    const char* interned = BA_StringIntern_Intern("Hello, World!");
+
+    BA_ASSERT(interned != NULL, "Failed to intern string\n");
+    BA_ASSERT(BA_STRINGINTERN_EQUALS(BA_StringIntern_Intern(buffer), interned), "Equal strings gave back different pointers\n");
+    BA_ASSERT(BA_StringIntern_InternLength("Hello, World! Goodbye", 13) == interned, "Length limited intern didn't match\n");
+    BA_ASSERT(BA_StringIntern_GetLength(interned) == 13, "Cached length is wrong\n");
+    BA_ASSERT(BA_StringIntern_Find("Hello, World!") == interned, "Failed to find interned string\n");
+    BA_ASSERT(BA_StringIntern_Find("Goodbye, Moon!") == NULL, "Found a string that was never interned\n");
+
+    BA_StringIntern_Atom atom = BA_StringIntern_GetAtom("Goodbye, Moon!");
+
+    BA_ASSERT(atom == 1, "Atoms should be handed out in order\n");
+    BA_ASSERT(strcmp(BA_StringIntern_GetString(atom), "Goodbye, Moon!") == 0, "Atom gave back the wrong string\n");
+    BA_ASSERT(BA_StringIntern_GetString(100) == NULL, "Got a string for an atom that doesn't exist\n");
+    BA_ASSERT(BA_StringIntern_GetHash(interned) != BA_StringIntern_GetHash(BA_StringIntern_GetString(atom)), "Hashes collided\n");
+
+    {
+        BA_DynamicArray* split = BA_String_Split("a b a c b", " ");
+        const char* output[5];
+
+        BA_ASSERT(split != NULL && split->used == 5, "Failed to split string\n");
+        BA_ASSERT(BA_StringIntern_InternDynamicArray(split, output), "Failed to intern array\n");
+        BA_ASSERT(output[0] == output[2] && output[1] == output[4] && output[0] != output[3], "Array was not interned correctly\n");
+
+        for (int i = 0; i < split->used; i++)
+            free(split->internalArray[i]);
+
+        free(split->internalArray);
+        free(split);
+    }
+
+    if (!BA_Thread_IsSingleThreaded()) {
+        BA_Thread threads[NUMBER_OF_THREADS];
+
+        BA_ASSERT(BA_Thread_CreateLock(&indexLock), "Failed to create lock\n");
+
+        for (int i = 0; i < NUMBER_OF_THREADS; i++)
+            BA_ASSERT(BA_Thread_Create(&threads[i], &ThreadFunction, NULL, NULL), "Failed to create thread\n");
+
+        for (int i = 0; i < NUMBER_OF_THREADS; i++)
+            BA_ASSERT(BA_Thread_Join(threads[i], NULL), "Failed to join thread\n");
+
+        for (int i = 0; i < NUMBER_OF_STRINGS; i++) {
+            BA_ASSERT(threadResults[0][i] != NULL, "Failed to intern string on thread\n");
+
+            for (int j = 1; j < NUMBER_OF_THREADS; j++)
+                BA_ASSERT(threadResults[j][i] == threadResults[0][i], "Threads got different pointers for the same string\n");
+        }
+
+        BA_Thread_DestroyLock(&indexLock);
+    }
+
+    BA_StringIntern_Free();
+    BA_ASSERT(BA_StringIntern_GetAmount() == 0, "Free didn't clear the pool\n");
+}
@@ -5,6 +5,7 @@
 #include <BaconAPI/StringManager.h>
 #include <BaconAPI/Logger.h>
 #include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/String.h>
 
 void Test(void) {
     int string1 = BA_StringManager_Allocate("Hello, World!",  BA_BOOLEAN_FALSE);
@@ -20,5 +21,32 @@ void Test(void) {
                    "%i: %s\n"
                    "%i: %s\n", string1, (const char*) BA_StringManager_Get(string1),
                                string2, (const char*) BA_StringManager_Get(string2));
+
+    {
+        int oldString = string1;
+
+        BA_StringManager_Deallocate(string1);
+        BA_ASSERT(BA_StringManager_Get(oldString) == NULL, "Got a deallocated string\n");
+
+        string1 = BA_StringManager_Allocate("Reused", BA_BOOLEAN_FALSE);
+
+        BA_ASSERT(string1 != oldString, "Reused slot gave the same index\n");
+        BA_ASSERT(BA_StringManager_Get(oldString) == NULL, "Old index works on a reused slot\n");
+        BA_StringManager_Replace(oldString, "Stale", BA_BOOLEAN_FALSE);
+        BA_StringManager_Deallocate(oldString);
+        BA_ASSERT(BA_String_Equals(BA_StringManager_Get(string1), "Reused", BA_BOOLEAN_FALSE), "Old index changed a reused slot\n");
+    }
+
+    // Slots keep getting reused, instead of new ones being made
+    for (int i = 0; i < 100000; i++) {
+        int string = BA_StringManager_Allocate("Churn", BA_BOOLEAN_FALSE);
+
+        BA_ASSERT(string != -1 && (string & 0xFFFFFF) == 2, "Slot was not reused\n");
+        BA_StringManager_Deallocate(string);
+    }
+
+    BA_StringManager_Deallocate(-1);
+    BA_ASSERT(BA_StringManager_Get(string2) == NULL, "Got a string after deallocating every string\n");
+    BA_ASSERT(BA_StringManager_Allocate("Again", BA_BOOLEAN_FALSE) == 0, "Deallocating every string did not start over\n");
     BA_StringManager_Deallocate(-1);
 }
@@ -0,0 +1,94 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/StringMatcher.h>
+
+#define NUMBER_OF_PATTERNS 3000
+#define TEXT_LENGTH 20000
+
+static size_t CountNaive(const char* text, const char* pattern) {
+    size_t amount = 0;
+
+    for (const char* found = strstr(text, pattern); found != NULL; found = strstr(found + 1, pattern))
+        amount++;
+
+    return amount;
+}
+
+static BA_Boolean CheckMatch(const BA_StringMatcher_Match* match, void* userData) {
+    const char** arguments = userData;
+    const char* pattern = arguments[match->pattern + 1];
+
+    BA_ASSERT(strncmp(arguments[0] + match->position, pattern, strlen(pattern)) == 0, "Match is in the wrong position\n");
+    return BA_BOOLEAN_TRUE;
+}
+
+void Test(void) {
+    BA_DynamicArray patterns;
+
+    BA_ASSERT(BA_DynamicArray_Create(&patterns, 10), "Failed to create array\n");
+    BA_DynamicArray_AddElementToLast(&patterns, "he");
+    BA_DynamicArray_AddElementToLast(&patterns, "she");
+    BA_DynamicArray_AddElementToLast(&patterns, "his");
+    BA_DynamicArray_AddElementToLast(&patterns, "hers");
+    BA_DynamicArray_AddElementToLast(&patterns, "");
+
+    {
+        BA_StringMatcher* matcher = BA_StringMatcher_Create(&patterns, BA_BOOLEAN_FALSE);
+        BA_StringMatcher* caselessMatcher = BA_StringMatcher_Create(&patterns, BA_BOOLEAN_TRUE);
+        BA_StringMatcher_Match match;
+        const char* arguments[] = {"ushers", "he", "she", "his", "hers"};
+
+        BA_ASSERT(matcher != NULL && caselessMatcher != NULL, "Failed to create matcher\n");
+        BA_ASSERT(BA_StringMatcher_IsDense(matcher), "Small pattern sets should be dense\n");
+        BA_ASSERT(BA_StringMatcher_Scan(matcher, "ushers", &CheckMatch, arguments) == 3, "Wrong amount of matches\n");
+        BA_ASSERT(BA_StringMatcher_FindFirst(matcher, "ushers", &match) && match.pattern == 1 && match.position == 1, "Wrong first match\n");
+        BA_ASSERT(!BA_StringMatcher_Contains(matcher, "USHERS") && BA_StringMatcher_Contains(caselessMatcher, "USHERS"), "Caseless matching failed\n");
+        BA_ASSERT(!BA_StringMatcher_Contains(matcher, "nothing to see"), "Found a pattern that isn't there\n");
+        BA_StringMatcher_Free(matcher);
+        BA_StringMatcher_Free(caselessMatcher);
+    }
+
+    free(patterns.internalArray);
+
+    // Big pattern set, checked against strstr
+    {
+        static char patternStrings[NUMBER_OF_PATTERNS][16];
+        static char text[TEXT_LENGTH + 1];
+
+        BA_ASSERT(BA_DynamicArray_Create(&patterns, NUMBER_OF_PATTERNS), "Failed to create array\n");
+        srand(4321);
+
+        for (int i = 0; i < NUMBER_OF_PATTERNS; i++) {
+            int length = rand() % 8 + 3;
+
+            for (int j = 0; j < length; j++)
+                patternStrings[i][j] = (char) ('a' + rand() % 12);
+
+            patternStrings[i][length] = '\0';
+
+            BA_DynamicArray_AddElementToLast(&patterns, patternStrings[i]);
+        }
+
+        for (int i = 0; i < TEXT_LENGTH; i++)
+            text[i] = (char) ('a' + rand() % 13);
+
+        BA_StringMatcher* matcher = BA_StringMatcher_Create(&patterns, BA_BOOLEAN_FALSE);
+        size_t expected = 0;
+
+        BA_ASSERT(matcher != NULL, "Failed to create matcher\n");
+        BA_ASSERT(!BA_StringMatcher_IsDense(matcher), "Big pattern sets should be compressed\n");
+
+        for (int i = 0; i < NUMBER_OF_PATTERNS; i++)
+            expected += CountNaive(text, patternStrings[i]);
+
+        BA_ASSERT(expected > 0 && BA_StringMatcher_Scan(matcher, text, NULL, NULL) == expected, "Compressed matcher missed matches\n");
+        BA_StringMatcher_Free(matcher);
+        free(patterns.internalArray);
+    }
+}
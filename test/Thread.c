@@ -29,7 +29,13 @@ void ThreadFunction(void* argument) {
     LockProtectedFunction();
 }
 
+void SemaphoreFunction(void* argument) {
+    BA_ASSERT(BA_Thread_PostSemaphore(argument), "Failed to post semaphore\n");
+}
+
 void Test(void) {
+    BA_ASSERT(BA_Thread_GetProcessorAmount() >= 1, "Processor amount is invalid\n");
+
     if (BA_Thread_IsSingleThreaded()) {
         BA_Thread throwaway;
         
@@ -66,4 +72,15 @@ void Test(void) {
         BA_ASSERT(BA_Thread_Join(addedThreads[i], NULL), "Failed to join thread %i\n", i);
 
     BA_ASSERT(BA_Thread_DestroyLock(&lock), "Failed to destroy lock\n");
+
+    {
+        BA_Thread thread;
+        BA_Thread_Semaphore semaphore;
+
+        BA_ASSERT(BA_Thread_CreateSemaphore(&semaphore, 0), "Failed to create semaphore\n");
+        BA_ASSERT(BA_Thread_Create(&thread, &SemaphoreFunction, NULL, &semaphore), "Failed to create thread\n");
+        BA_ASSERT(BA_Thread_WaitSemaphore(&semaphore), "Failed to wait for semaphore\n");
+        BA_ASSERT(BA_Thread_Join(thread, NULL), "Failed to join thread\n");
+        BA_ASSERT(BA_Thread_DestroySemaphore(&semaphore), "Failed to destroy semaphore\n");
+    }
 }
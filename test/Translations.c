@@ -1,11 +1,23 @@
 // Copyright (c) 2024, PortalPlayer <email@portalplayer.xyz>
 // Licensed under MIT <https://opensource.org/licenses/MIT>
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <BaconAPI/Translations.h>
 #include <BaconAPI/Logger.h>
 #include <BaconAPI/StringManager.h>
 #include <BaconAPI/Debugging/Assert.h>
 #include <BaconAPI/String.h>
+#include <BaconAPI/Hash.h>
+
+// Where things are in a language pack
+#define PACK_HEADER_SIZE 56
+#define PACK_ENTRY_AMOUNT_OFFSET 32
+#define PACK_SLOT_AMOUNT_OFFSET 36
+#define PACK_TEXT_LENGTH_OFFSET 40
+#define PACK_CHECKSUM_OFFSET 48
+#define PACK_SLOT_SIZE 16
 
 BA_TRANSLATIONS_PRELOAD(GetTest1String, "test.hello")
 BA_TRANSLATIONS_PRELOAD(GetTest2String, "test.hello2")
@@ -18,6 +30,137 @@ BA_ASSERT(BA_String_Equals(GetTest2String(), "Colo" u "ring?", BA_BOOLEAN_FALSE)
 void Test(void) {
     TEST("");
     TEST("u");
+
+    {
+        char* language = malloc(50000 * 48);
+        size_t length = 0;
+        int firstId = BA_Translations_GetTranslationId("test.hello");
+
+        BA_ASSERT(language != NULL, "Failed to allocate memory for language\n");
+
+        for (int i = 0; i < 50000; i++)
+            length += (size_t) sprintf(language + length, "test.key%i=Value %i\n", i, i);
+
+        sprintf(language + length, "test.key7=Last\n");
+        BA_Translations_LoadLanguage("big", language);
+        BA_ASSERT(BA_Translations_GetTranslationId("test.hello") == firstId, "Translation ID changed between languages\n");
+        BA_ASSERT(BA_Translations_GetTranslationId("test.missing") == -1, "Found a translation that doesn't exist\n");
+        BA_ASSERT(BA_String_Equals(BA_StringManager_Get(BA_Translations_GetTranslationId("test.key7")), "Last", BA_BOOLEAN_FALSE), "Duplicate key did not give the last one\n");
+
+        for (int i = 0; i < 50000; i += 97) {
+            char key[32];
+            char value[32];
+
+            sprintf(key, "test.key%i", i);
+            sprintf(value, "Value %i", i);
+            BA_ASSERT(i == 7 || BA_String_Equals(BA_StringManager_Get(BA_Translations_GetTranslationId(key)), value, BA_BOOLEAN_FALSE), "Wrong translation\n");
+        }
+
+        free(language);
+    }
+
+    {
+        const char* longKey = "test.a.key.that.is.much.longer.than.the.longest.key.hashed.while.compiling";
+
+        BA_ASSERT(BA_TRANSLATIONS_HASH("test.hello") == BA_Translations_HashKey("test.hello", 10), "Compile time hash does not match expected\n");
+        BA_ASSERT(BA_TRANSLATIONS_HASH("") == BA_Translations_HashKey("", 0), "Compile time hash does not match expected\n");
+        BA_ASSERT(BA_TRANSLATIONS_HASH("test.a.key.that.is.much.longer.than.the.longest.key.hashed.while.compiling") == BA_Translations_HashKey(longKey, strlen(longKey)), "Long key hash does not match expected\n");
+        BA_ASSERT(BA_Translations_GetTranslationIdFromHash(BA_TRANSLATIONS_HASH("test.hello")) == BA_Translations_GetTranslationId("test.hello"), "Translation ID from hash does not match expected\n");
+        BA_ASSERT(BA_Translations_GetTranslationIdFromHash(BA_TRANSLATIONS_HASH("test.missing")) == -1, "Found a translation that doesn't exist\n");
+    }
+
+    {
+        BA_Translations_Pack* pack;
+        FILE* file;
+
+        BA_ASSERT(BA_Translations_CompilePack("es", "test.hello=Hola\ntest.hello2=Primero\ntest.hello2=Segundo", "TranslationsTest.pack"), "Failed to compile language pack\n");
+        BA_ASSERT(!BA_Translations_CompilePack("a.code.that.is.too.long", "test.hello=Hola", "TranslationsTest.pack"), "Compiled a pack with a code that's too long\n");
+
+        pack = BA_Translations_OpenPack("TranslationsTest.pack");
+
+        BA_ASSERT(pack != NULL, "Failed to open language pack\n");
+        BA_Translations_UsePack(pack);
+        BA_ASSERT(BA_String_Equals(GetTest1String(), "Hola", BA_BOOLEAN_FALSE), "Wrong translation from pack\n");
+        BA_ASSERT(BA_String_Equals(GetTest2String(), "Segundo", BA_BOOLEAN_FALSE), "Duplicate key in pack did not give the last one\n");
+        BA_ASSERT(BA_String_Equals(BA_Translations_GetLanguageCode(NULL), "es", BA_BOOLEAN_FALSE), "Wrong language code from pack\n");
+        BA_ASSERT(BA_Translations_Get("test.key1") == NULL, "Pack has a translation it shouldn't\n");
+
+        // Loaded languages come back once the pack isn't used
+        BA_Translations_UsePack(NULL);
+        BA_ASSERT(BA_String_Equals(GetTest1String(), "Colour me surprised!", BA_BOOLEAN_FALSE), "Wrong translation after leaving pack\n");
+        BA_Translations_UsePack(pack);
+        BA_Translations_ClosePack(pack);
+        BA_ASSERT(BA_String_Equals(BA_Translations_Get("test.hello"), "Colour me surprised!", BA_BOOLEAN_FALSE), "Closing pack did not stop using it\n");
+
+        {
+            unsigned char data[4096];
+            size_t length;
+            uint32_t entryAmount = 0;
+            uint32_t slotAmount = 1 << 30;
+            uint64_t textLength;
+            uint64_t checksum;
+
+            file = fopen("TranslationsTest.pack", "rb");
+
+            BA_ASSERT(file != NULL, "Failed to open language pack\n");
+
+            length = fread(data, 1, sizeof(data), file);
+
+            fclose(file);
+            BA_ASSERT(length > PACK_HEADER_SIZE && length < sizeof(data), "Language pack size does not match expected\n");
+
+            // A slot amount way past the end of the file, with a text length that wraps around to the right size
+            textLength = (uint64_t) length - (PACK_HEADER_SIZE + (uint64_t) slotAmount * PACK_SLOT_SIZE);
+            checksum = BA_Hash_Bytes(data + PACK_HEADER_SIZE, length - PACK_HEADER_SIZE);
+
+            memcpy(data + PACK_ENTRY_AMOUNT_OFFSET, &entryAmount, sizeof(entryAmount));
+            memcpy(data + PACK_SLOT_AMOUNT_OFFSET, &slotAmount, sizeof(slotAmount));
+            memcpy(data + PACK_TEXT_LENGTH_OFFSET, &textLength, sizeof(textLength));
+            memcpy(data + PACK_CHECKSUM_OFFSET, &checksum, sizeof(checksum));
+
+            file = fopen("TranslationsTest.oversized.pack", "wb");
+
+            BA_ASSERT(file != NULL, "Failed to create language pack\n");
+            fwrite(data, 1, length, file);
+            fclose(file);
+            BA_ASSERT(BA_Translations_OpenPack("TranslationsTest.oversized.pack") == NULL, "Opened a pack with an oversized header\n");
+
+            // Not even a whole header
+            file = fopen("TranslationsTest.oversized.pack", "wb");
+
+            BA_ASSERT(file != NULL, "Failed to create language pack\n");
+            fwrite(data, 1, PACK_HEADER_SIZE / 2, file);
+            fclose(file);
+            BA_ASSERT(BA_Translations_OpenPack("TranslationsTest.oversized.pack") == NULL, "Opened a truncated pack\n");
+            remove("TranslationsTest.oversized.pack");
+        }
+
+        file = fopen("TranslationsTest.pack", "r+b");
+
+        BA_ASSERT(file != NULL, "Failed to open language pack\n");
+        fseek(file, -2, SEEK_END);
+        fputc('X', file);
+        fclose(file);
+        BA_ASSERT(BA_Translations_OpenPack("TranslationsTest.pack") == NULL, "Opened a damaged pack\n");
+        BA_ASSERT(BA_Translations_OpenPack("TranslationsTest.missing") == NULL, "Opened a missing pack\n");
+        remove("TranslationsTest.pack");
+    }
+
     BA_StringManager_Deallocate(-1);
     BA_Translations_Destroy();
+
+    {
+        BA_Translations_Pack* pack;
+
+        BA_ASSERT(BA_Translations_CompilePack("es", "test.hello=Hola", "TranslationsTest.pack"), "Failed to compile language pack\n");
+
+        pack = BA_Translations_OpenPack("TranslationsTest.pack");
+
+        BA_ASSERT(pack != NULL, "Failed to open language pack\n");
+        BA_Translations_UsePack(pack);
+        BA_Translations_Destroy();
+        BA_ASSERT(BA_Translations_Get("test.hello") == NULL, "Destroying did not stop using the pack\n");
+        BA_Translations_ClosePack(pack);
+        remove("TranslationsTest.pack");
+    }
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+// Copyright (c) 2026, PortalPlayer <email@portalplayer.xyz>
+// Licensed under MIT <https://opensource.org/licenses/MIT>
+
+#include <string.h>
+#include <stdlib.h>
+#include <BaconAPI/ArgumentHandler.h>
+#include <BaconAPI/Debugging/Assert.h>
+#include <BaconAPI/Unicode.h>
+#include <BaconAPI/String.h>
+#include <BaconAPI/WideString.h>
+
+#define UNICODE_INVALID(string) \
+do {                            \
+    uint32_t output[8];         \
+    BA_ASSERT(!BA_Unicode_ValidateUTF8(string, sizeof(string) - 1), "Invalid UTF-8 passed validation\n"); \
+    BA_ASSERT(BA_Unicode_UTF8ToUTF32(string, sizeof(string) - 1, output) == BA_UNICODE_ERROR, "Converted invalid UTF-8\n"); \
+} while (BA_BOOLEAN_FALSE)
+
+// Long enough to go through the vector kernels, with multi-byte characters on both sides of a block boundary
+static const char mixed[] = "The quick brown fox jumps over \xC3\xA9 the lazy dog \xE2\x82\xAC and then some more ASCII text to fill a block \xF0\x9F\x98\x80 end";
+
+void Test(void) {
+    size_t mixedLength = sizeof(mixed) - 1;
+    uint32_t utf32[sizeof(mixed)];
+    uint16_t utf16[sizeof(mixed)];
+    char utf8[sizeof(mixed) * 4];
+    size_t utf32Length = BA_Unicode_UTF8ToUTF32(mixed, mixedLength, utf32);
+    size_t utf16Length = BA_Unicode_UTF8ToUTF16(mixed, mixedLength, utf16);
+
+    BA_ASSERT(BA_Unicode_ValidateUTF8(mixed, mixedLength), "Valid UTF-8 failed validation\n");
+    BA_ASSERT(!BA_Unicode_IsASCII(mixed, mixedLength), "Non-ASCII string reported as ASCII\n");
+    BA_ASSERT(BA_Unicode_IsASCII(mixed, 30), "ASCII string reported as non-ASCII\n");
+    BA_ASSERT(utf32Length == mixedLength - 1 - 2 - 3, "Wrong amount of code points\n");
+    BA_ASSERT(utf32[31] == 0xE9 && utf32[46] == 0x20AC && utf32[utf32Length - 5] == 0x1F600, "Decoded the wrong code points\n");
+    BA_ASSERT(utf16Length == utf32Length + 1, "Wrong amount of UTF-16 code units\n");
+    BA_ASSERT(BA_Unicode_GetUTF8LengthFromUTF32(utf32, utf32Length) == mixedLength, "Wrong UTF-8 length from UTF-32\n");
+    BA_ASSERT(BA_Unicode_GetUTF8LengthFromUTF16(utf16, utf16Length) == mixedLength, "Wrong UTF-8 length from UTF-16\n");
+    BA_ASSERT(BA_Unicode_UTF32ToUTF8(utf32, utf32Length, utf8) == mixedLength && memcmp(utf8, mixed, mixedLength) == 0, "UTF-32 did not round trip\n");
+    BA_ASSERT(BA_Unicode_UTF16ToUTF8(utf16, utf16Length, utf8) == mixedLength && memcmp(utf8, mixed, mixedLength) == 0, "UTF-16 did not round trip\n");
+
+    UNICODE_INVALID("\xC0\x80"); // Overlong
+    UNICODE_INVALID("\xE0\x80\x80"); // Overlong
+    UNICODE_INVALID("\xED\xA0\x80"); // Surrogate
+    UNICODE_INVALID("\xF4\x90\x80\x80"); // Above U+10FFFF
+    UNICODE_INVALID("\xE2\x82"); // Cut off
+    UNICODE_INVALID("abc\x80"); // Lone continuation byte
+
+    {
+        uint32_t surrogate = 0xD800;
+        uint16_t unpaired = 0xDC00;
+
+        BA_ASSERT(BA_Unicode_UTF32ToUTF8(&surrogate, 1, utf8) == BA_UNICODE_ERROR, "Encoded a surrogate\n");
+        BA_ASSERT(BA_Unicode_UTF16ToUTF8(&unpaired, 1, utf8) == BA_UNICODE_ERROR, "Encoded an unpaired surrogate\n");
+    }
+
+    {
+        wchar_t* wide = BA_WideString_Convert(mixed);
+
+        BA_ASSERT(wide != NULL, "Failed to convert to a wide string\n");
+        BA_ASSERT(wcslen(wide) == (sizeof(wchar_t) == 4 ? utf32Length : utf16Length), "Wide string has the wrong length\n");
+
+        char* narrow = BA_String_Convert(wide);
+
+        BA_ASSERT(narrow != NULL && strcmp(narrow, mixed) == 0, "Wide string did not round trip\n");
+        BA_ASSERT(BA_WideString_Convert("\xC0\x80") == NULL, "Converted invalid UTF-8\n");
+        free(narrow);
+        free(wide);
+    }
+}